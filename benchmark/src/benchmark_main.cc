@@ -24,6 +24,7 @@
 #include "reverse_bench.hpp"
 #include "fill_bench.hpp"
 #include "find_bench.hpp"
+#include "find_run_bench.hpp"
 #include "shift_bench.hpp"
 #include "copy_bench.hpp"
 #include "move_bench.hpp"
@@ -32,6 +33,20 @@
 #include "transform_bench.hpp"
 #include "equal_bench.hpp"
 #include "rw_bench.hpp"
+#include "id_allocator_bench.hpp"
+#include "execution_bench.hpp"
+#include "bit_array_bench.hpp"
+#include "small_bit_vector_bench.hpp"
+#include "bit_stream_bench.hpp"
+#include "universal_codes_bench.hpp"
+#include "dynamic_bit_vector_bench.hpp"
+#include "bit_vector_bench.hpp"
+#include "bit_expression_bench.hpp"
+#include "transform_assign_bench.hpp"
+#include "transform_n_bench.hpp"
+#include "intersect_n_bench.hpp"
+#include "set_predicates_bench.hpp"
+#include "mismatch_bench.hpp"
 // Third party libraries
 #include <benchmark/benchmark.h>
 #include <iostream>
@@ -41,6 +56,7 @@
 #include <string>
 #include <string_view>
 #include <typeinfo>
+#include <thread>
 // ========================================================================== //
 
 std::string demangle(const char* name) {
@@ -284,6 +300,10 @@ int main(int argc, char** argv) {
             BM_BitTransformBinaryUU, 
             "bit::transform(BinaryOp) (small) (UU)",
             size_small);
+    register_word_containers<decltype(BM_BitTransformBinaryUA), std::vector>(
+            BM_BitTransformBinaryUA, 
+            "bit::transform(BinaryOp) (small) (UA)",
+            size_small);
     register_word_containers<decltype(BM_DynamicBitsetTransformBinary), std::vector>(
             BM_DynamicBitsetTransformBinary, 
             "dynamic_bitset::transform(BinaryOp) (small) ",
@@ -304,6 +324,10 @@ int main(int argc, char** argv) {
             BM_BitTransformBinaryUU, 
             "bit::transform(BinaryOp) (large) (UU)",
             size_large);
+    register_word_containers<decltype(BM_BitTransformBinaryUA), std::vector>(
+            BM_BitTransformBinaryUA, 
+            "bit::transform(BinaryOp) (large) (UA)",
+            size_large);
     register_word_containers<decltype(BM_DynamicBitsetTransformBinary), std::vector>(
             BM_DynamicBitsetTransformBinary, 
             "dynamic_bitset::transform(BinaryOp) (large) ",
@@ -535,6 +559,216 @@ int main(int argc, char** argv) {
             "std::find (large)",
             size_large);
 
+    // Run search benchmarks
+    register_word_containers<decltype(BM_BitFindRun), std::vector>(
+            BM_BitFindRun,
+            "bit::find_run (large)",
+            size_large);
+    register_bool_containers<decltype(BM_BoolFindRun), std::vector>(
+            BM_BoolFindRun,
+            "std::search_n (large)",
+            size_large);
+
+    // Fixed-size array benchmarks
+    benchmark::RegisterBenchmark("bit::bit_array::count (256)",
+            BM_FixedArrayCount, std::make_tuple(bit::bit_array<256>()));
+    benchmark::RegisterBenchmark("std::bitset::count (256)",
+            BM_FixedArrayCount, std::make_tuple(std::bitset<256>()));
+    benchmark::RegisterBenchmark("bit::bit_array::count (4096)",
+            BM_FixedArrayCount, std::make_tuple(bit::bit_array<4096>()));
+    benchmark::RegisterBenchmark("std::bitset::count (4096)",
+            BM_FixedArrayCount, std::make_tuple(std::bitset<4096>()));
+    benchmark::RegisterBenchmark("bit::bit_array::operator^= (256)",
+            BM_FixedArrayXor, std::make_tuple(bit::bit_array<256>()));
+    benchmark::RegisterBenchmark("std::bitset::operator^= (256)",
+            BM_FixedArrayXor, std::make_tuple(std::bitset<256>()));
+    benchmark::RegisterBenchmark("bit::bit_array::operator^= (4096)",
+            BM_FixedArrayXor, std::make_tuple(bit::bit_array<4096>()));
+    benchmark::RegisterBenchmark("std::bitset::operator^= (4096)",
+            BM_FixedArrayXor, std::make_tuple(std::bitset<4096>()));
+    benchmark::RegisterBenchmark("bit::bit_array::operator== (4096)",
+            BM_FixedArrayEqual, std::make_tuple(bit::bit_array<4096>()));
+    benchmark::RegisterBenchmark("std::bitset::operator== (4096)",
+            BM_FixedArrayEqual, std::make_tuple(std::bitset<4096>()));
+
+    // Small buffer benchmarks
+    benchmark::RegisterBenchmark("bit::bit_vector build (200)",
+            BM_ShortVectorBuild,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), 200u));
+    benchmark::RegisterBenchmark("bit::small_bit_vector build (200)",
+            BM_ShortVectorBuild,
+            std::make_tuple(bit::small_bit_vector<uint64_t>(), uint64_t(), 200u));
+    benchmark::RegisterBenchmark("bit::bit_vector copy (200)",
+            BM_ShortVectorCopy,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), 200u));
+    benchmark::RegisterBenchmark("bit::small_bit_vector copy (200)",
+            BM_ShortVectorCopy,
+            std::make_tuple(bit::small_bit_vector<uint64_t>(), uint64_t(), 200u));
+
+    // Bit field stream benchmarks
+    benchmark::RegisterBenchmark("bit::bit_writer::put (medium)",
+            BM_BitWriterPut,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("bit::write_word (medium)",
+            BM_WriteWordPut,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("bit::bit_reader::get (medium)",
+            BM_BitReaderGet,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("bit::get_word (medium)",
+            BM_GetWordGet,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+
+    // Universal code benchmarks
+    benchmark::RegisterBenchmark("bit::decode_n gamma (medium)",
+            BM_GammaDecodeN,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("bit::find gamma (medium)",
+            BM_GammaDecodeFind,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+
+    // Mid-sequence edit benchmarks
+    benchmark::RegisterBenchmark("bit::bit_vector insert/erase (large)",
+            BM_BitVectorMidEdit,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::dynamic_bit_vector insert/erase (large)",
+            BM_DynamicBitVectorMidEdit,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+
+    // Growth benchmarks
+    benchmark::RegisterBenchmark("bit::bit_vector::push_back (medium)",
+            BM_BitVectorPushBack,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("std::vector<bool>::push_back (medium)",
+            BM_BoolVectorPushBack,
+            std::make_tuple(std::vector<bool>(), bool(), size_medium));
+    benchmark::RegisterBenchmark("bit::bit_vector::append (medium)",
+            BM_BitVectorAppend,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("std::vector<bool>::insert at end (medium)",
+            BM_BoolVectorAppend,
+            std::make_tuple(std::vector<bool>(), bool(), size_medium));
+    benchmark::RegisterBenchmark("std::vector<bit::bit_vector> growth (medium)",
+            BM_BitVectorVectorGrowth,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_medium));
+    benchmark::RegisterBenchmark("std::vector<std::vector<uint64_t>> growth (medium)",
+            BM_WordVectorVectorGrowth,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_medium));
+
+    // Bitwise expression benchmarks
+    benchmark::RegisterBenchmark("bit::bit_vector (a & b) | ~c (large)",
+            BM_BitExpression,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform (a & b) | ~c (large)",
+            BM_BitTransformChain,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::bit_vector (a & b).count() (large)",
+            BM_BitExpressionCount,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+
+    // Compound assignment benchmarks
+    benchmark::RegisterBenchmark("bit::bit_vector::operator|= (large)",
+            BM_BitVectorOrAssign,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform |= (large)",
+            BM_BitTransformOrAssign,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform_assign |= (large) (UU)",
+            BM_BitTransformAssignOffset,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform |= (large) (UU)",
+            BM_BitTransformOffset,
+            std::make_tuple(bit::bit_vector<uint64_t>(), uint64_t(), size_large));
+
+    // N-ary transform benchmarks
+    benchmark::RegisterBenchmark("bit::transform_n and of 8 (large)",
+            BM_BitTransformNAnd,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform chained and of 8 (large)",
+            BM_BitTransformChainAnd,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform_n at least 3 of 8 (large)",
+            BM_BitTransformNAtLeast,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+
+    // Intersection benchmarks
+    benchmark::RegisterBenchmark("bit::intersect_n of 16 sparse (large)",
+            BM_BitIntersectN,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform_n and of 16 sparse (large)",
+            BM_BitTransformNAndSparse,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::intersect_count of 16 sparse (large)",
+            BM_BitIntersectCount,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+
+    // Set predicate benchmarks
+    benchmark::RegisterBenchmark("bit::is_subset_of (large)",
+            BM_BitIsSubsetOf,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::is_subset_of (UA) (large)",
+            BM_BitIsSubsetOfUA,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::transform and bit::equal subset (large)",
+            BM_BitTransformEqualSubset,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+
+    // Mismatch benchmarks
+    benchmark::RegisterBenchmark("bit::mismatch (large)",
+            BM_BitMismatch,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::mismatch (UA) (large)",
+            BM_BitMismatchUA,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_large));
+    benchmark::RegisterBenchmark("bit::bit_vector sort (medium)",
+            BM_BitVectorSort,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_medium));
+
+    // Concurrent id allocation benchmarks
+    const int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    benchmark::RegisterBenchmark(
+            "bit::id_allocator (medium)",
+            BM_BitIdAllocator,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_medium))
+        ->ThreadRange(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::id_allocator nearly full (medium)",
+            BM_BitIdAllocatorNearlyFull,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_medium))
+        ->ThreadRange(1, max_threads)->UseRealTime();
+
+    // Parallel scaling benchmarks
+    benchmark::RegisterBenchmark(
+            "bit::count par (huge)",
+            BM_BitParallelCount,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_huge))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::transform par (huge)",
+            BM_BitParallelTransform,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_huge))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::find par (huge)",
+            BM_BitParallelFind,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_huge))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::find par (small)",
+            BM_BitParallelFind,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_small))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::shift_left par (huge)",
+            BM_BitParallelShiftLeft,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_huge))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+    benchmark::RegisterBenchmark(
+            "bit::rotate par (huge)",
+            BM_BitParallelRotate,
+            std::make_tuple(std::vector<uint64_t>(), uint64_t(), size_huge))
+        ->RangeMultiplier(2)->Range(1, max_threads)->UseRealTime();
+
     //// Search benchmarks
     //register_word_containers<decltype(BM_BitSearch), std::vector>(
             //BM_BitSearch, 
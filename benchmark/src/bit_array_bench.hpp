@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include "test_utils.hpp"
+#include "bitlib/bit-containers/bit_array.hpp"
+
+// The first element of the input is the fixed-size container to benchmark,
+// either a bit::bit_array or a std::bitset of the same size
+template <class Array>
+Array make_random_fixed_array() {
+    Array arr;
+    for (std::size_t i = 0; i < arr.size(); ++i) {
+        if (generate_random_number(0, 1)) {
+            arr.flip(i);
+        }
+    }
+    return arr;
+}
+
+auto BM_FixedArrayCount = [](benchmark::State& state, auto input) {
+    using array_type = typename std::tuple_element<0, decltype(input)>::type;
+    array_type arr = make_random_fixed_array<array_type>();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arr);
+        benchmark::DoNotOptimize(arr.count());
+    }
+};
+
+auto BM_FixedArrayXor = [](benchmark::State& state, auto input) {
+    using array_type = typename std::tuple_element<0, decltype(input)>::type;
+    array_type arr1 = make_random_fixed_array<array_type>();
+    array_type arr2 = make_random_fixed_array<array_type>();
+    for (auto _ : state) {
+        arr1 ^= arr2;
+        benchmark::DoNotOptimize(arr1);
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_FixedArrayEqual = [](benchmark::State& state, auto input) {
+    using array_type = typename std::tuple_element<0, decltype(input)>::type;
+    array_type arr1 = make_random_fixed_array<array_type>();
+    array_type arr2 = arr1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(arr2);
+        benchmark::DoNotOptimize(arr1 == arr2);
+    }
+};
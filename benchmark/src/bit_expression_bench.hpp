@@ -0,0 +1,60 @@
+#include <functional>
+#include <random>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+
+template <class WordType>
+bit::bit_vector<WordType> make_expression_operand(unsigned int total_bits, std::uint64_t seed) {
+    std::mt19937_64 gen(seed);
+    std::vector<WordType> words(total_bits / bit::binary_digits<WordType>::value);
+    for (auto& word : words) {
+        word = static_cast<WordType>(gen());
+    }
+    return bit::bit_vector<WordType>(words.begin(), words.end());
+}
+
+// (a & b) | ~c in one pass over the words
+auto BM_BitExpression = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto a = make_expression_operand<word_type>(total_bits, 1);
+    auto b = make_expression_operand<word_type>(total_bits, 2);
+    auto c = make_expression_operand<word_type>(total_bits, 3);
+    bit::bit_vector<word_type> result(total_bits);
+    for (auto _ : state) {
+        result = (a & b) | ~c;
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same with one bit::transform per operator, and temporaries
+auto BM_BitTransformChain = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto a = make_expression_operand<word_type>(total_bits, 1);
+    auto b = make_expression_operand<word_type>(total_bits, 2);
+    auto c = make_expression_operand<word_type>(total_bits, 3);
+    bit::bit_vector<word_type> result(total_bits);
+    for (auto _ : state) {
+        bit::bit_vector<word_type> a_and_b(total_bits);
+        bit::bit_vector<word_type> not_c(total_bits);
+        bit::transform(a.begin(), a.end(), b.begin(), a_and_b.begin(), std::bit_and<word_type>());
+        bit::transform(c.begin(), c.end(), not_c.begin(), std::bit_not<word_type>());
+        bit::transform(a_and_b.begin(), a_and_b.end(), not_c.begin(), result.begin(), std::bit_or<word_type>());
+        benchmark::DoNotOptimize(result.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+// Size of a & b, without materializing it
+auto BM_BitExpressionCount = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto a = make_expression_operand<word_type>(total_bits, 1);
+    auto b = make_expression_operand<word_type>(total_bits, 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize((a & b).count());
+    }
+};
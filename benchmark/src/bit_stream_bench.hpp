@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-containers/bit_stream.hpp"
+
+// Fields of 1 to 32 bits, total_bits of them in all
+inline std::vector<unsigned int> make_field_widths(unsigned int total_bits) {
+    std::vector<unsigned int> widths;
+    for (unsigned int bits = 0; bits < total_bits;) {
+        widths.push_back(1 + generate_random_number(0, 31));
+        bits += widths.back();
+    }
+    return widths;
+}
+
+auto BM_BitWriterPut = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto widths = make_field_widths(total_bits);
+    bit::bit_vector<word_type> bv;
+    bv.reserve(total_bits + 64);
+    for (auto _ : state) {
+        bv.clear();
+        bit::bit_writer<word_type> writer(bv);
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            writer.put(i, widths[i]);
+        }
+        writer.flush();
+        benchmark::DoNotOptimize(bv.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same fields, each written with write_word through a bit iterator
+auto BM_WriteWordPut = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto widths = make_field_widths(total_bits);
+    bit::bit_vector<word_type> bv(total_bits + 64);
+    for (auto _ : state) {
+        auto it = bv.begin();
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            bit::write_word<word_type>(static_cast<word_type>(i), it,
+                    static_cast<word_type>(widths[i]));
+            it += widths[i];
+        }
+        benchmark::DoNotOptimize(bv.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitReaderGet = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto widths = make_field_widths(total_bits);
+    bit::bit_vector<word_type> bv;
+    {
+        bit::bit_writer<word_type> writer(bv);
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            writer.put(i, widths[i]);
+        }
+    }
+    for (auto _ : state) {
+        bit::bit_reader<word_type> reader(bv);
+        std::uint64_t sum = 0;
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            sum += reader.get(widths[i]);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+};
+
+auto BM_GetWordGet = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto widths = make_field_widths(total_bits);
+    auto words = get_random_vec<word_type>(total_bits / bit::binary_digits<word_type>::value + 2);
+    bit::bit_vector<word_type> bv(words.begin(), words.end());
+    for (auto _ : state) {
+        auto it = bv.begin();
+        std::uint64_t sum = 0;
+        for (unsigned int i = 0; i < widths.size(); ++i) {
+            sum += bit::get_word<word_type>(it, widths[i]);
+            it += widths[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+};
@@ -0,0 +1,102 @@
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+
+// Builds a vector of total_bits bits one push_back at a time
+auto BM_BitVectorPushBack = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    for (auto _ : state) {
+        bit::bit_vector<word_type> bv;
+        for (unsigned int i = 0; i < total_bits; ++i) {
+            bv.push_back((i * 0x9E3779B9u) >> 31 ? bit::bit1 : bit::bit0);
+        }
+        benchmark::DoNotOptimize(bv.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BoolVectorPushBack = [](benchmark::State& state, auto input) {
+    unsigned int total_bits = std::get<2>(input);
+    for (auto _ : state) {
+        std::vector<bool> bv;
+        for (unsigned int i = 0; i < total_bits; ++i) {
+            bv.push_back((i * 0x9E3779B9u) >> 31);
+        }
+        benchmark::DoNotOptimize(&bv);
+        benchmark::ClobberMemory();
+    }
+};
+
+// Builds a vector of total_bits bits from unaligned chunks of another one,
+// and runs of a single value
+auto BM_BitVectorAppend = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    std::mt19937_64 gen(42);
+    std::vector<word_type> words(1024 / bit::binary_digits<word_type>::value);
+    for (auto& word : words) {
+        word = static_cast<word_type>(gen());
+    }
+    bit::bit_vector<word_type> chunk(words.begin(), words.end());
+    for (auto _ : state) {
+        bit::bit_vector<word_type> bv;
+        while (bv.size() < total_bits) {
+            bv.append(chunk.begin() + 3, chunk.end());
+            bv.append(bit::bit1, 77);
+        }
+        benchmark::DoNotOptimize(bv.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BoolVectorAppend = [](benchmark::State& state, auto input) {
+    unsigned int total_bits = std::get<2>(input);
+    std::mt19937_64 gen(42);
+    std::vector<bool> chunk(1024);
+    for (std::size_t i = 0; i < chunk.size(); ++i) {
+        chunk[i] = gen() & 1;
+    }
+    for (auto _ : state) {
+        std::vector<bool> bv;
+        while (bv.size() < total_bits) {
+            bv.insert(bv.end(), chunk.begin() + 3, chunk.end());
+            bv.insert(bv.end(), 77, true);
+        }
+        benchmark::DoNotOptimize(&bv);
+        benchmark::ClobberMemory();
+    }
+};
+
+// Grows a std::vector of 256 bit vectors of total_bits bits each, which
+// moves every element on each reallocation
+auto BM_BitVectorVectorGrowth = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    const bit::bit_vector<word_type> bv(total_bits, bit::bit1);
+    for (auto _ : state) {
+        std::vector<bit::bit_vector<word_type>> vecs;
+        for (int i = 0; i < 256; ++i) {
+            vecs.push_back(bv);
+        }
+        benchmark::DoNotOptimize(vecs.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same with the words in plain vectors, as a lower bound
+auto BM_WordVectorVectorGrowth = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    const std::vector<word_type> words(total_bits / bit::binary_digits<word_type>::value, word_type(-1));
+    for (auto _ : state) {
+        std::vector<std::vector<word_type>> vecs;
+        for (int i = 0; i < 256; ++i) {
+            vecs.push_back(words);
+        }
+        benchmark::DoNotOptimize(vecs.data());
+        benchmark::ClobberMemory();
+    }
+};
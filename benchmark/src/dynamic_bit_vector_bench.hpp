@@ -0,0 +1,32 @@
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-containers/dynamic_bit_vector.hpp"
+
+// Inserts a bit at a random position and erases another one, so that the
+// size stays at total_bits
+auto BM_BitVectorMidEdit = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    bit::bit_vector<word_type> vec(total_bits, bit::bit1);
+    unsigned long long pos = generate_random_number(0, total_bits - 1);
+    for (auto _ : state) {
+        pos = (pos * 6364136223846793005ULL + 1442695040888963407ULL) % total_bits;
+        vec.insert(vec.cbegin() + pos, bit::bit0);
+        vec.erase(vec.begin() + (total_bits - pos));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_DynamicBitVectorMidEdit = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    bit::dynamic_bit_vector<word_type> vec(total_bits, bit::bit1);
+    unsigned long long pos = generate_random_number(0, total_bits - 1);
+    for (auto _ : state) {
+        pos = (pos * 6364136223846793005ULL + 1442695040888963407ULL) % total_bits;
+        vec.insert(pos, bit::bit0);
+        vec.erase(total_bits - pos);
+        benchmark::ClobberMemory();
+    }
+};
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+#include <math.h>
+#include <functional>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/execution.hpp"
+#include "bitlib/bit-algorithms/count.hpp"
+#include "bitlib/bit-algorithms/transform.hpp"
+
+// Scaling benchmarks: state.range(0) is the number of threads of the pool.
+// The ranges start and end off word boundaries to exercise the partial
+// head and tail words.
+auto BM_BitParallelCount = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    bit::execution::thread_pool pool(state.range(0));
+    const auto policy = bit::execution::par.on(pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::count(policy, first + 2, last - 3, bit::bit1));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (total_bits / 8));
+};
+
+auto BM_BitParallelTransform = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont1 = make_random_container<container_type>(container_size);
+    container_type bitcont2 = make_random_container<container_type>(container_size);
+    container_type bitcont3(container_size);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto last1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto d_first = bit::bit_iterator<decltype(std::begin(bitcont3))>(std::begin(bitcont3));
+    bit::execution::thread_pool pool(state.range(0));
+    const auto policy = bit::execution::par.on(pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::transform(
+                policy, first1 + 2, last1 - 3, first2 + 2, d_first + 5, std::bit_and<word_type>()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (total_bits / 8) * 3);
+};
+
+// The only set bit is at 3/4 of the range, so workers scanning chunks past it
+// are cancelled. With one thread this is the serial find.
+auto BM_BitParallelFind = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    *(first + total_bits / 4 * 3 + 4) = bit::bit1;
+    bit::execution::thread_pool pool(state.range(0));
+    const auto policy = bit::execution::par.on(pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::find(policy, first + 2, last - 3, bit::bit1));
+        benchmark::ClobberMemory();
+    }
+};
+
+// Sliding-buffer style shift by a few bits more than a word
+auto BM_BitParallelShiftLeft = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    bit::execution::thread_pool pool(state.range(0));
+    const auto policy = bit::execution::par.on(pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::shift_left(policy, first, last, digits + 3));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (total_bits / 8));
+};
+
+auto BM_BitParallelRotate = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont = make_random_container<container_type>(container_size);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    bit::execution::thread_pool pool(state.range(0));
+    const auto policy = bit::execution::par.on(pool);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::rotate(policy, first, first + total_bits / 16 + 7, last));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * (total_bits / 8));
+};
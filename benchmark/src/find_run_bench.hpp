@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+#include <math.h>
+#include <algorithm>
+#include "bitlib/bit-algorithms/find_run.hpp"
+#include "bitlib/bit-algorithms/fill.hpp"
+
+// Every 64-bit stretch holds a short run of zeros; the first run of 100 zeros
+// is in the middle of the range.
+auto BM_BitFindRun = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<word_type>::value;
+    auto container_size = ceil(float(total_bits) / digits);
+    container_type bitcont(container_size, static_cast<word_type>(-1));
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    for (unsigned int i = 5; i + 64 < total_bits; i += 64) {
+        bit::fill(first + i, first + i + 40, bit::bit0);
+    }
+    bit::fill(first + total_bits / 2, first + total_bits / 2 + 100, bit::bit0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::find_run(first, last, bit::bit0, 100));
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BoolFindRun = [](benchmark::State& state, auto input) {
+    using container_type = std::vector<bool>;
+    unsigned int container_size = std::get<2>(input);
+    container_type cont(container_size, true);
+    for (unsigned int i = 5; i + 64 < container_size; i += 64) {
+        std::fill(cont.begin() + i, cont.begin() + i + 40, false);
+    }
+    std::fill(cont.begin() + container_size / 2, cont.begin() + container_size / 2 + 100, false);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::search_n(cont.begin(), cont.end(), 100, false));
+        benchmark::ClobberMemory();
+    }
+};
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include "bitlib/bit-containers/id_allocator.hpp"
+
+// Every benchmark thread repeatedly takes a batch of ids from one shared
+// pool and gives them back. Registered with ThreadRange to measure scaling.
+auto BM_BitIdAllocator = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    using allocator_type = bit::id_allocator<word_type>;
+    unsigned int total_ids = std::get<2>(input);
+    constexpr size_t batch = 64;
+    static std::unique_ptr<allocator_type> alloc;
+    if (state.thread_index() == 0) {
+        alloc = std::make_unique<allocator_type>(total_ids);
+    }
+    std::vector<size_t> ids;
+    ids.reserve(batch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch; ++i) {
+            ids.push_back(alloc->allocate());
+        }
+        for (size_t id : ids) {
+            alloc->deallocate(id);
+        }
+        ids.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+};
+
+// Same as above, but the pool is kept nearly full so that the summary level
+// has to skip over full words.
+auto BM_BitIdAllocatorNearlyFull = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    using allocator_type = bit::id_allocator<word_type>;
+    unsigned int total_ids = std::get<2>(input);
+    constexpr size_t batch = 64;
+    static std::unique_ptr<allocator_type> alloc;
+    if (state.thread_index() == 0) {
+        alloc = std::make_unique<allocator_type>(total_ids);
+        const size_t headroom = batch * state.threads() * 2;
+        for (size_t i = 0; i + headroom < total_ids; ++i) {
+            alloc->allocate();
+        }
+    }
+    std::vector<size_t> ids;
+    ids.reserve(batch);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch; ++i) {
+            ids.push_back(alloc->allocate());
+        }
+        for (size_t id : ids) {
+            alloc->deallocate(id);
+        }
+        ids.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+};
@@ -0,0 +1,69 @@
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/intersect_n.hpp"
+#include "bitlib/bit-algorithms/transform_n.hpp"
+#include "bitlib/bit-containers/bit_span.hpp"
+
+// Sixteen sparse bitmaps, with about one bit in 64 set, every other one
+// starting inside its first word
+template <class WordType>
+std::vector<std::vector<WordType>> make_sparse_bitmaps(unsigned int total_bits) {
+    std::vector<std::vector<WordType>> words;
+    for (int i = 0; i < 16; ++i) {
+        words.push_back(std::vector<WordType>(
+                total_bits / bit::binary_digits<WordType>::value + 1, static_cast<WordType>(-1)));
+        for (int s = 0; s < 6; ++s) {
+            const auto random = get_random_vec<WordType>(words.back().size());
+            for (std::size_t j = 0; j < random.size(); ++j) {
+                words.back()[j] &= random[j];
+            }
+        }
+    }
+    return words;
+}
+
+template <class WordType>
+std::vector<bit::bit_span<WordType>> make_sparse_bitmap_spans(
+        std::vector<std::vector<WordType>>& words, unsigned int total_bits) {
+    std::vector<bit::bit_span<WordType>> spans;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        spans.emplace_back(words[i].data(), i % 2 ? 2 * i + 1 : 0, total_bits);
+    }
+    return spans;
+}
+
+auto BM_BitIntersectN = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_sparse_bitmaps<word_type>(total_bits);
+    auto spans = make_sparse_bitmap_spans(words, total_bits);
+    std::vector<word_type> out(words[0].size());
+    for (auto _ : state) {
+        bit::intersect_n(spans, bit::bit_iterator<word_type*>(out.data()));
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same without skipping the inputs of the empty blocks
+auto BM_BitTransformNAndSparse = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_sparse_bitmaps<word_type>(total_bits);
+    auto spans = make_sparse_bitmap_spans(words, total_bits);
+    std::vector<word_type> out(words[0].size());
+    for (auto _ : state) {
+        bit::transform_n(spans, bit::bit_iterator<word_type*>(out.data()), bit::bit_and_all());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitIntersectCount = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_sparse_bitmaps<word_type>(total_bits);
+    auto spans = make_sparse_bitmap_spans(words, total_bits);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bit::intersect_count(spans));
+    }
+};
@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bitlib.hpp"
+
+// Only really care about benchmarking when the ranges are equal up to their
+// last bit, since it is the worst case scenario
+template <class WordType>
+void BM_BitMismatchOffset(benchmark::State& state, unsigned int total_bits, std::size_t offset) {
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    auto words1 = get_random_vec<WordType>(total_bits / digits + 1);
+    std::vector<WordType> words2(words1.size() + 1);
+    auto first1 = bit::bit_iterator<WordType*>(words1.data());
+    auto first2 = bit::bit_iterator<WordType*>(words2.data()) + offset;
+    bit::copy(first1, first1 + total_bits, first2);
+    first2[total_bits - 1] = ~first2[total_bits - 1];
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bit::mismatch(first1, first1 + total_bits, first2));
+}
+
+auto BM_BitMismatch = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    BM_BitMismatchOffset<WordType>(state, std::get<2>(input), 0);
+};
+
+auto BM_BitMismatchUA = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    BM_BitMismatchOffset<WordType>(state, std::get<2>(input), 5);
+};
+
+// Sorting keys of 200 bits, which share their first word among few values
+auto BM_BitVectorSort = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int num_keys = std::get<2>(input);
+    std::vector<bit::bit_vector<WordType>> keys;
+    for (unsigned int i = 0; i < num_keys; ++i) {
+        keys.emplace_back(200);
+        auto words = get_random_vec<WordType>(keys.back().size() / bit::binary_digits<WordType>::value);
+        words[0] %= 16;
+        std::copy(words.begin(), words.end(), keys.back().data());
+    }
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto sorted = keys;
+        state.ResumeTiming();
+        std::sort(sorted.begin(), sorted.end());
+        benchmark::DoNotOptimize(sorted.data());
+    }
+};
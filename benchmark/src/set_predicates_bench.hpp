@@ -0,0 +1,58 @@
+#include <functional>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bitlib.hpp"
+
+// Only really care about benchmarking when the first range is a subset of
+// the second one, since it is the worst case scenario. The second range
+// starts offset bits into its words.
+template <class WordType>
+struct subset_bench_ranges {
+    subset_bench_ranges(unsigned int total_bits, std::size_t offset)
+        : words1(get_random_vec<WordType>(total_bits / bit::binary_digits<WordType>::value + 2)),
+          words2(get_random_vec<WordType>(words1.size())),
+          first1(words1.data()),
+          first2(bit::bit_iterator<WordType*>(words2.data()) + offset),
+          total_bits(total_bits) {
+        auto words3 = words2;
+        bit::copy(first1, first1 + total_bits, first2);
+        for (std::size_t i = 0; i < words2.size(); ++i) {
+            words2[i] |= words3[i];
+        }
+    }
+    std::vector<WordType> words1;
+    std::vector<WordType> words2;
+    bit::bit_iterator<WordType*> first1;
+    bit::bit_iterator<WordType*> first2;
+    unsigned int total_bits;
+};
+
+auto BM_BitIsSubsetOf = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    subset_bench_ranges<WordType> ranges(std::get<2>(input), 0);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bit::is_subset_of(
+            ranges.first1, ranges.first1 + ranges.total_bits, ranges.first2));
+};
+
+auto BM_BitIsSubsetOfUA = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    subset_bench_ranges<WordType> ranges(std::get<2>(input), 7);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(bit::is_subset_of(
+            ranges.first1, ranges.first1 + ranges.total_bits, ranges.first2));
+};
+
+// The same through a temporary intersection
+auto BM_BitTransformEqualSubset = [](benchmark::State& state, auto input) {
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    subset_bench_ranges<WordType> ranges(std::get<2>(input), 0);
+    std::vector<WordType> temp(ranges.words1.size());
+    const bit::bit_iterator<WordType*> temp_first(temp.data());
+    for (auto _ : state) {
+        bit::transform(ranges.first1, ranges.first1 + ranges.total_bits, ranges.first2,
+                temp_first, std::bit_and<WordType>());
+        benchmark::DoNotOptimize(bit::equal(
+            ranges.first1, ranges.first1 + ranges.total_bits, temp_first));
+    }
+};
@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-containers/small_bit_vector.hpp"
+
+// Builds many short-lived vectors of total_bits bits, which is where the
+// inline buffer of small_bit_vector saves the allocation. The first element
+// of the input is the vector type.
+auto BM_ShortVectorBuild = [](benchmark::State& state, auto input) {
+    using vector_type = typename std::tuple_element<0, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    for (auto _ : state) {
+        vector_type vec;
+        for (unsigned int i = 0; i < total_bits; ++i) {
+            vec.push_back(bit::bit_value(bool(i & 1)));
+        }
+        benchmark::DoNotOptimize(vec.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_ShortVectorCopy = [](benchmark::State& state, auto input) {
+    using vector_type = typename std::tuple_element<0, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    vector_type vec(total_bits, bit::bit1);
+    for (auto _ : state) {
+        vector_type copy(vec);
+        benchmark::DoNotOptimize(copy.data());
+        benchmark::ClobberMemory();
+    }
+};
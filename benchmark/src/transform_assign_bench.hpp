@@ -0,0 +1,57 @@
+#include <functional>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/transform.hpp"
+#include "bitlib/bit-algorithms/transform_assign.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+
+// acc |= other on whole vectors
+auto BM_BitVectorOrAssign = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = get_random_vec<word_type>(total_bits / bit::binary_digits<word_type>::value);
+    bit::bit_vector<word_type> acc(words.begin(), words.end());
+    const bit::bit_vector<word_type> other(words.rbegin(), words.rend());
+    for (auto _ : state) {
+        acc |= other;
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same through bit::transform, with the accumulator as first input
+auto BM_BitTransformOrAssign = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = get_random_vec<word_type>(total_bits / bit::binary_digits<word_type>::value);
+    bit::bit_vector<word_type> acc(words.begin(), words.end());
+    bit::bit_vector<word_type> other(words.rbegin(), words.rend());
+    for (auto _ : state) {
+        bit::transform(acc.begin(), acc.end(), other.begin(), acc.begin(), std::bit_or<word_type>());
+        benchmark::ClobberMemory();
+    }
+};
+
+// Ranges that start at different positions in their words
+auto BM_BitTransformAssignOffset = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = get_random_vec<word_type>(total_bits / bit::binary_digits<word_type>::value);
+    bit::bit_vector<word_type> acc(words.begin(), words.end());
+    bit::bit_vector<word_type> other(words.rbegin(), words.rend());
+    for (auto _ : state) {
+        bit::transform_assign(acc.begin() + 2, acc.end() - 5, other.begin() + 5, std::bit_or<word_type>());
+        benchmark::ClobberMemory();
+    }
+};
+
+auto BM_BitTransformOffset = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = get_random_vec<word_type>(total_bits / bit::binary_digits<word_type>::value);
+    bit::bit_vector<word_type> acc(words.begin(), words.end());
+    bit::bit_vector<word_type> other(words.rbegin(), words.rend());
+    for (auto _ : state) {
+        bit::transform(acc.begin() + 2, acc.end() - 5, other.begin() + 5, acc.begin() + 2, std::bit_or<word_type>());
+        benchmark::ClobberMemory();
+    }
+};
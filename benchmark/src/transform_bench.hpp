@@ -154,6 +154,34 @@ auto BM_BitTransformBinaryUU = [](benchmark::State& state, auto input) {
     }
 };
 
+// Both sources at the same offset, into an aligned destination
+auto BM_BitTransformBinaryUA = [](benchmark::State& state, auto input) {
+    using container_type = typename std::tuple_element<0, decltype(input)>::type;
+    using WordType = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto digits = bit::binary_digits<WordType>::value;
+    auto container_size = total_bits / digits + 1;
+    auto bitvec1 = get_random_vec<WordType>(container_size);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitvec1))>(std::begin(bitvec1));
+    auto bitvec2 = get_random_vec<WordType>(container_size);
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitvec2))>(std::begin(bitvec2));
+    auto bitvec3 = get_random_vec<WordType>(container_size);
+    auto d_first = bit::bit_iterator<decltype(std::begin(bitvec3))>(std::begin(bitvec3));
+
+    constexpr auto binary_op = std::bit_or<WordType>();
+    for (auto _ : state)
+    {
+        bit::transform(
+            first1 + 3,
+            first1 + total_bits - 4,
+            first2 + 3,
+            d_first,
+            binary_op
+        );
+        benchmark::ClobberMemory();
+    }
+};
+
 auto BM_DynamicBitsetTransformBinary = [](benchmark::State& state, auto input) {
     using container_type = typename std::tuple_element<0, decltype(input)>::type;
     using WordType = typename std::tuple_element<1, decltype(input)>::type;
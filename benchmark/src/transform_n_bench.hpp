@@ -0,0 +1,70 @@
+#include <functional>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/transform.hpp"
+#include "bitlib/bit-algorithms/transform_n.hpp"
+#include "bitlib/bit-containers/bit_span.hpp"
+
+// Eight bitmaps, the last four of them starting inside their first word
+template <class WordType>
+std::vector<std::vector<WordType>> make_bitmaps(unsigned int total_bits) {
+    std::vector<std::vector<WordType>> words;
+    for (int i = 0; i < 8; ++i) {
+        words.push_back(get_random_vec<WordType>(total_bits / bit::binary_digits<WordType>::value + 1));
+    }
+    return words;
+}
+
+template <class WordType>
+std::vector<bit::bit_span<WordType>> make_bitmap_spans(
+        std::vector<std::vector<WordType>>& words, unsigned int total_bits) {
+    std::vector<bit::bit_span<WordType>> spans;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        spans.emplace_back(words[i].data(), i < 4 ? 0 : 2 * i + 1, total_bits);
+    }
+    return spans;
+}
+
+// Bits set in all eight bitmaps, in one pass
+auto BM_BitTransformNAnd = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_bitmaps<word_type>(total_bits);
+    auto spans = make_bitmap_spans(words, total_bits);
+    std::vector<word_type> out(words[0].size());
+    for (auto _ : state) {
+        bit::transform_n(spans, bit::bit_iterator<word_type*>(out.data()), bit::bit_and_all());
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same with a chain of binary transforms into an accumulator
+auto BM_BitTransformChainAnd = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_bitmaps<word_type>(total_bits);
+    auto spans = make_bitmap_spans(words, total_bits);
+    std::vector<word_type> out(words[0].size());
+    auto acc = bit::bit_iterator<word_type*>(out.data());
+    for (auto _ : state) {
+        bit::transform(spans[0].begin(), spans[0].end(), spans[1].begin(), acc, std::bit_and<word_type>());
+        for (std::size_t i = 2; i < spans.size(); ++i) {
+            bit::transform(acc, acc + total_bits, spans[i].begin(), acc, std::bit_and<word_type>());
+        }
+        benchmark::ClobberMemory();
+    }
+};
+
+// Bits set in at least three of the eight bitmaps
+auto BM_BitTransformNAtLeast = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    auto words = make_bitmaps<word_type>(total_bits);
+    auto spans = make_bitmap_spans(words, total_bits);
+    std::vector<word_type> out(words[0].size());
+    for (auto _ : state) {
+        bit::transform_n(spans, bit::bit_iterator<word_type*>(out.data()), bit::bit_at_least(3));
+        benchmark::ClobberMemory();
+    }
+};
@@ -0,0 +1,60 @@
+#include <random>
+#include <benchmark/benchmark.h>
+#include "test_utils.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bitlib/bit-algorithms/find.hpp"
+#include "bitlib/bit-containers/bit_vector.hpp"
+#include "bitlib/bit-containers/universal_codes.hpp"
+
+// Gaps of a sorted list, mostly small, gamma coded into about total_bits
+// bits
+template <class WordType>
+bit::bit_vector<WordType> make_gamma_gaps(unsigned int total_bits, std::size_t& count) {
+    bit::bit_vector<WordType> bv;
+    bit::bit_writer<WordType> writer(bv);
+    std::mt19937_64 gen(42);
+    count = 0;
+    while (writer.size() < total_bits) {
+        const std::uint64_t r = gen();
+        bit::gamma_code().encode(writer, 1 + ((r & 1023) >> ((r >> 10) % 11)));
+        ++count;
+    }
+    writer.flush();
+    return bv;
+}
+
+auto BM_GammaDecodeN = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    std::size_t count;
+    auto bv = make_gamma_gaps<word_type>(total_bits, count);
+    std::vector<std::uint64_t> out(count);
+    for (auto _ : state) {
+        bit::bit_reader<word_type> reader(bv);
+        bit::decode_n(reader, out.begin(), count, bit::gamma_code());
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+};
+
+// The same codes, with the unary prefix found by bit::find and the rest
+// read by get_word
+auto BM_GammaDecodeFind = [](benchmark::State& state, auto input) {
+    using word_type = typename std::tuple_element<1, decltype(input)>::type;
+    unsigned int total_bits = std::get<2>(input);
+    std::size_t count;
+    auto bv = make_gamma_gaps<word_type>(total_bits, count);
+    std::vector<std::uint64_t> out(count);
+    for (auto _ : state) {
+        auto it = bv.begin();
+        for (std::size_t i = 0; i < count; ++i) {
+            auto one = bit::find(it, bv.end(), bit::bit1);
+            const unsigned int n = one - it;
+            it = one + 1;
+            out[i] = (std::uint64_t(1) << n) | (n ? bit::get_word<word_type>(it, n) : 0);
+            it += n;
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+};
@@ -25,15 +25,23 @@
 #include "copy.hpp"
 #include "count.hpp"
 #include "debug_utils.hpp"
+#include "dispatch.hpp"
 #include "equal.hpp"
+#include "execution.hpp"
 #include "fill.hpp"
 #include "find.hpp"
+#include "find_run.hpp"
+#include "intersect_n.hpp"
+#include "mismatch.hpp"
 #include "move.hpp"
 #include "reverse.hpp"
 #include "rotate.hpp"
+#include "set_predicates.hpp"
 #include "shift.hpp"
 #include "swap_ranges.hpp"
 #include "transform.hpp"
+#include "transform_assign.hpp"
+#include "transform_n.hpp"
 #include "type_traits.hpp"
 // ========================================================================== //
 
@@ -14,6 +14,8 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <functional>
+#include <type_traits>
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
 // Third-party libraries
@@ -279,11 +281,11 @@ void write_word(src_type src, bit_iterator<OutputIt> dst_bit_it,
 template <class RandomAccessIt>
 RandomAccessIt word_shift_left(RandomAccessIt first,
                           RandomAccessIt last,
-                          typename RandomAccessIt::difference_type n
+                          typename std::iterator_traits<RandomAccessIt>::difference_type n
 )
 {
     if (n <= 0) return last;
-    if (n >= distance(first, last)) return first;
+    if (n >= std::distance(first, last)) return first;
     RandomAccessIt mid = first + n;
     auto ret = std::move(mid, last, first);
     return ret;
@@ -296,10 +298,10 @@ RandomAccessIt word_shift_left(RandomAccessIt first,
 template <class RandomAccessIt>
 RandomAccessIt word_shift_right(RandomAccessIt first,
                           RandomAccessIt last,
-                          typename RandomAccessIt::difference_type n
+                          typename std::iterator_traits<RandomAccessIt>::difference_type n
 )
 {
-    auto d = distance(first, last);
+    auto d = std::distance(first, last);
     if (n <= 0) return first;
     if (n >= d) return last;
     std::move_backward(first, last-n, last);
@@ -421,6 +423,44 @@ typename bit_iterator<It>::word_type _padded_read(bit_iterator<It> first,
 
 
 
+// ---------------------------- Word Operations ----------------------------- //
+// Bits of lhs that are not in rhs, the word operation of set difference
+template <class T = void>
+struct bit_andnot {
+    constexpr T operator()(const T& lhs, const T& rhs) const noexcept {
+        return static_cast<T>(lhs & static_cast<T>(~rhs));
+    }
+};
+
+template <>
+struct bit_andnot<void> {
+    template <class T>
+    constexpr T operator()(const T& lhs, const T& rhs) const noexcept {
+        return static_cast<T>(lhs & static_cast<T>(~rhs));
+    }
+};
+
+// Whether Op is one of the standard bitwise word operations. Each bit of
+// their result only depends on the bits at the same position in the
+// operands, so they commute with shifts: op(a >> n, b >> n) == op(a, b) >> n.
+template <class Op>
+struct _is_bitwise_operation : std::false_type {};
+
+template <class T>
+struct _is_bitwise_operation<std::bit_and<T>> : std::true_type {};
+
+template <class T>
+struct _is_bitwise_operation<std::bit_or<T>> : std::true_type {};
+
+template <class T>
+struct _is_bitwise_operation<std::bit_xor<T>> : std::true_type {};
+
+template <class T>
+struct _is_bitwise_operation<bit_andnot<T>> : std::true_type {};
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace bit
 #endif // _BIT_ALGORITHM_DETAILS_HPP_INCLUDED
@@ -17,6 +17,7 @@
 #include <math.h>
 // Project sources
 #include "bitlib/bitlib.hpp"
+#include "execution.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace bit {
@@ -42,7 +43,7 @@ constexpr bit_iterator<RandomAccessIt2> copy(bit_iterator<RandomAccessIt1> first
 
     // Assertions
     _assert_range_viability(first, last);
-    static_assert(::std::is_same<dst_word_type, src_word_type>::value, "Underlying word types must be equal");
+    static_assert(::std::is_same<dst_word_type, ::std::remove_cv_t<src_word_type>>::value, "Underlying word types must be equal");
     if (first == last) return d_first;
 
 
@@ -104,6 +105,32 @@ constexpr bit_iterator<RandomAccessIt2> copy(bit_iterator<RandomAccessIt1> first
 }
 // -------------------------------------------------------------------------- //
 
+// ----------------------- Parallel Copy Algorithm -------------------------- //
+// Chunks are split on the word boundaries of the destination, so that no
+// destination word is written by two threads
+template <class ExecutionPolicy, class RandomAccessIt1, class RandomAccessIt2>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt2>>
+copy(ExecutionPolicy&& policy,
+     bit_iterator<RandomAccessIt1> first,
+     bit_iterator<RandomAccessIt1> last,
+     bit_iterator<RandomAccessIt2> d_first
+)
+{
+    using word_type = typename bit_iterator<RandomAccessIt2>::word_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return copy(first, last, d_first);
+    }
+    _parallel_for_words<word_type>(par, num_chunks, n, d_first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            copy(first + begin, first + end, d_first + begin);
+        });
+    return d_first + n;
+}
+// -------------------------------------------------------------------------- //
+
 
 
 // ========================================================================== //
@@ -11,9 +11,12 @@
 // C++ standard library
 #include <iterator>
 #include <numeric>
+#include <type_traits>
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
 #include "bitlib/bit-algorithms//libpopcnt.h"
+#include "dispatch.hpp"
+#include "execution.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
 #include "hwy/highway.h"
@@ -92,15 +95,23 @@ count(
                     //[](word_type word) {return _popcnt(word); }
             //);
 
+#ifdef BITLIB_DISPATCH
+            const auto num_words = std::distance(it, last.base());
+            if (num_words > 0) {
+                result += _simd_popcount<std::remove_cv_t<word_type>>(&*it, num_words);
+            }
+#else
             // libpopcnt
             result += popcnt(&*it, (digits / 8) * std::distance(it, last.base()));
+#endif
         }
         if (last.position() != 0) {
             word_type last_value = *last.base() << (digits - last.position());
             result += _popcnt(last_value);
         }
-    // Computation when bits belong to the same underlying word
-    } else {
+    // Computation when bits belong to the same underlying word. The word of
+    // an empty range may be past the end, and is not read.
+    } else if (first.position() != last.position()) {
         result = _popcnt(
             _bextr<word_type>(*first.base(), first.position(), last.position()
               - first.position())
@@ -116,6 +127,35 @@ count(
     return result;
 }
 
+// ------------------------- Parallel Count Algorithm ----------------------- //
+// Each chunk is counted serially and the partial counts are summed
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, typename bit_iterator<RandomAccessIt>::difference_type>
+count(
+    ExecutionPolicy&& policy,
+    bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last,
+    bit_value value
+) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using difference_type = typename bit_iterator<RandomAccessIt>::difference_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return count(first, last, value);
+    }
+    std::vector<difference_type> partial(num_chunks, 0);
+    _parallel_for_words<word_type>(par, num_chunks, n, first.position(),
+        [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            partial[chunk] = count(first + begin, first + end, value);
+        });
+    return std::accumulate(partial.begin(), partial.end(), difference_type(0));
+}
+// -------------------------------------------------------------------------- //
+
+
+
 } // namespace bit
 #ifdef BITLIB_HWY
 HWY_AFTER_NAMESPACE();
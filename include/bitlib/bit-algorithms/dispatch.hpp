@@ -0,0 +1,741 @@
+// ================================ DISPATCH ================================ //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            dispatch.hpp
+// Description:     Word kernels compiled for several instruction sets, one of
+//                  which is selected at runtime from the features of the CPU
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _DISPATCH_HPP_INCLUDED
+#define _DISPATCH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/libpopcnt.h"
+// Third-party libraries
+// Miscellaneous
+// The AVX2 and AVX-512 variants rely on the target attribute and on
+// __builtin_cpu_supports, so they only exist with GCC compatible compilers
+// on x86. Everywhere else the scalar kernels are the only target.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define _BITLIB_DISPATCH_X86
+#define _BITLIB_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define _BITLIB_ALWAYS_INLINE inline
+#endif
+
+namespace bit {
+namespace simd {
+// ========================================================================== //
+
+
+
+/* ******************************** TARGETS ********************************* */
+//! The instruction sets the word kernels are compiled for
+enum class target {
+    scalar,  // baseline instruction set of the build
+    avx2,    // AVX2 and POPCNT
+    avx512   // AVX-512 F and BW, and POPCNT
+};
+
+inline const char* target_name(target t) noexcept {
+    switch (t) {
+        case target::avx2: return "avx2";
+        case target::avx512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+// Whether the kernels of target t can run on this CPU
+inline bool supported(target t) noexcept {
+#ifdef _BITLIB_DISPATCH_X86
+    __builtin_cpu_init();
+    switch (t) {
+        case target::scalar:
+            return true;
+        case target::avx2:
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+        case target::avx512:
+            return __builtin_cpu_supports("avx512f")
+                && __builtin_cpu_supports("avx512bw")
+                && __builtin_cpu_supports("popcnt");
+    }
+    return false;
+#else
+    return t == target::scalar;
+#endif
+}
+
+// The best target supported by this CPU
+inline target detected_target() noexcept {
+    for (target t : {target::avx512, target::avx2}) {
+        if (supported(t)) {
+            return t;
+        }
+    }
+    return target::scalar;
+}
+
+inline std::atomic<target>& _active_target() noexcept {
+    static std::atomic<target> active{detected_target()};
+    return active;
+}
+
+// The target the kernels currently run with. It is detected once, the first
+// time it is needed, and only changes through set_target or reset_target.
+inline target current_target() noexcept {
+    return _active_target().load(std::memory_order_relaxed);
+}
+
+// Forces the kernels of target t, e.g. to compare or benchmark targets.
+// Throws std::invalid_argument if the CPU does not support t.
+inline void set_target(target t) {
+    if (!supported(t)) {
+        throw std::invalid_argument(
+            std::string("SIMD target not supported by this CPU: ") + target_name(t));
+    }
+    _active_target().store(t, std::memory_order_relaxed);
+}
+
+// Goes back to the detected target
+inline void reset_target() noexcept {
+    _active_target().store(detected_target(), std::memory_order_relaxed);
+}
+/* ************************************************************************** */
+} // namespace simd
+
+
+
+// ----------------------------- WORD KERNELS ------------------------------- //
+// The kernels are written once as plain loops, which the compiler
+// vectorizes for the instruction set of the variant they are inlined into.
+// Fixed size blocks keep the loops free of early exits and of loop carried
+// dependencies, both of which prevent vectorization.
+template <class T>
+constexpr std::size_t _simd_block = 128 / sizeof(T);
+
+template <class T>
+_BITLIB_ALWAYS_INLINE std::size_t _popcount_words(const T* p, std::size_t n) noexcept {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        result += _popcnt(p[i]);
+    }
+    return result;
+}
+
+// Index of the first word different from value, or n if there is none
+template <class T>
+_BITLIB_ALWAYS_INLINE std::size_t _find_not_words(const T* p, std::size_t n, T value) noexcept {
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        T diff = 0;
+        for (std::size_t j = 0; j < block; ++j) {
+            diff |= p[i + j] ^ value;
+        }
+        if (diff != 0) {
+            break;
+        }
+    }
+    while (i < n && p[i] == value) {
+        ++i;
+    }
+    return i;
+}
+
+template <class T>
+_BITLIB_ALWAYS_INLINE void _fill_words(T* p, std::size_t n, T value) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        p[i] = value;
+    }
+}
+
+template <class T, class UnaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_words(
+        const T* src, std::size_t n, T* dst, UnaryOperation op) {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = op(src[i]);
+    }
+}
+
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_words(
+        const T* src1, const T* src2, std::size_t n, T* dst, BinaryOperation op) {
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = op(src1[i], src2[i]);
+    }
+}
+
+// dst[i] = _shrd(src[i], src[i + 1], offset) for i in [0, n), front to back,
+// with 0 < offset < digits. dst may overlap src as long as dst <= src, which
+// is what shift_left needs: every block is read before it is written.
+template <class T>
+_BITLIB_ALWAYS_INLINE void _shrd_words_forward(
+        T* dst, const T* src, std::size_t n, std::size_t offset) noexcept {
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        T buffer[block];
+        for (std::size_t j = 0; j < block; ++j) {
+            buffer[j] = static_cast<T>(
+                (src[i + j] >> offset) | (src[i + j + 1] << (digits - offset)));
+        }
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[i + j] = buffer[j];
+        }
+    }
+    for (; i < n; ++i) {
+        dst[i] = static_cast<T>((src[i] >> offset) | (src[i + 1] << (digits - offset)));
+    }
+}
+
+// Same as _shrd_words_forward, back to front, for dst > src as needed by
+// shift_right
+template <class T>
+_BITLIB_ALWAYS_INLINE void _shrd_words_backward(
+        T* dst, const T* src, std::size_t n, std::size_t offset) noexcept {
+    constexpr std::size_t digits = binary_digits<T>::value;
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t i = n;
+    for (; i >= block; i -= block) {
+        T buffer[block];
+        for (std::size_t j = 0; j < block; ++j) {
+            buffer[j] = static_cast<T>(
+                (src[i - block + j] >> offset) | (src[i - block + j + 1] << (digits - offset)));
+        }
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[i - block + j] = buffer[j];
+        }
+    }
+    while (i-- > 0) {
+        dst[i] = static_cast<T>((src[i] >> offset) | (src[i + 1] << (digits - offset)));
+    }
+}
+
+// dst[i] = op(dst[i], _shrd(src[i], src[i + 1], offset)) for i in [0, n),
+// with 0 < offset < digits: combines dst with the bits of src that start at
+// offset. src needs n + 1 readable words, and may not overlap dst.
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_shrd_words(
+        T* dst, const T* src, std::size_t n, std::size_t offset, BinaryOperation op) {
+    constexpr std::size_t digits = binary_digits<T>::value;
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = static_cast<T>(op(dst[i], static_cast<T>(
+            (src[i] >> offset) | (src[i + 1] << (digits - offset)))));
+    }
+}
+
+// Bits [offset, offset + digits) of the pair of words lo, hi, for
+// 0 <= offset < digits. hi is shifted in two steps so that offset 0 is
+// defined, which keeps the kernels below free of a branch on the offset.
+template <class T>
+_BITLIB_ALWAYS_INLINE T _funnel_word(T lo, T hi, std::size_t offset) noexcept {
+    constexpr std::size_t digits = binary_digits<T>::value;
+    return static_cast<T>((lo >> offset) | (static_cast<T>(hi << 1) << (digits - 1 - offset)));
+}
+
+// dst[i] = op(src1 word i, src2 word i) for i in [0, n), where the words of
+// each source start at its offset, with 0 <= offset < digits. Each source
+// needs n + 1 readable words. Every block is read before it is written, so
+// dst may overlap a source as long as dst <= source.
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_shrd2_words(
+        const T* src1, std::size_t offset1,
+        const T* src2, std::size_t offset2,
+        std::size_t n, T* dst, BinaryOperation op) {
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        T buffer1[block];
+        T buffer2[block];
+        for (std::size_t j = 0; j < block; ++j) {
+            buffer1[j] = _funnel_word(src1[i + j], src1[i + j + 1], offset1);
+            buffer2[j] = _funnel_word(src2[i + j], src2[i + j + 1], offset2);
+        }
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[i + j] = static_cast<T>(op(buffer1[j], buffer2[j]));
+        }
+    }
+    for (; i < n; ++i) {
+        dst[i] = static_cast<T>(op(
+            _funnel_word(src1[i], src1[i + 1], offset1),
+            _funnel_word(src2[i], src2[i + 1], offset2)));
+    }
+}
+
+// Same as _transform_shrd2_words for two sources at the same offset and a
+// bitwise op, which commutes with the shift: the words are combined first
+// and only the result is shifted.
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _shrd_transform_words(
+        const T* src1, const T* src2, std::size_t n, std::size_t offset,
+        T* dst, BinaryOperation op) {
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        T buffer[block + 1];
+        for (std::size_t j = 0; j <= block; ++j) {
+            buffer[j] = static_cast<T>(op(src1[i + j], src2[i + j]));
+        }
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[i + j] = _funnel_word(buffer[j], buffer[j + 1], offset);
+        }
+    }
+    for (; i < n; ++i) {
+        dst[i] = _funnel_word(
+            static_cast<T>(op(src1[i], src2[i])),
+            static_cast<T>(op(src1[i + 1], src2[i + 1])),
+            offset);
+    }
+}
+
+// buffer[j] = op of the k words of the rows at position first + j, for j in
+// [0, M). The fixed trip count lets the inner loops vectorize.
+template <std::size_t M, class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_rows_block(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t first, T* buffer, BinaryOperation op) {
+    const T* row = rows[0] + first;
+    for (std::size_t j = 0; j < M; ++j) {
+        buffer[j] = _funnel_word(row[j], row[j + 1], offsets[0]);
+    }
+    for (std::size_t i = 1; i < k; ++i) {
+        row = rows[i] + first;
+        for (std::size_t j = 0; j < M; ++j) {
+            buffer[j] = static_cast<T>(op(buffer[j], _funnel_word(row[j], row[j + 1], offsets[i])));
+        }
+    }
+}
+
+// dst[j] = op of the k words of the rows at position j, for j in [0, n),
+// with k > 0. The words of row i start at bit offsets[i] of rows[i], which
+// needs n + 1 readable words. The rows are combined a block at a time into
+// a buffer that stays in registers or cache, so each row is read once, and
+// dst may be one of the rows at the same position.
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE void _transform_rows_words(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, T* dst, BinaryOperation op) {
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t first = 0;
+    for (; first + block <= n; first += block) {
+        T buffer[block];
+        _transform_rows_block<block>(rows, offsets, k, first, buffer, op);
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[first + j] = buffer[j];
+        }
+    }
+    for (; first < n; ++first) {
+        T buffer[1];
+        _transform_rows_block<1>(rows, offsets, k, first, buffer, op);
+        dst[first] = buffer[0];
+    }
+}
+
+// Index of the first i in [0, n) where op(src1[i], s) has a bit set, s
+// being the word at bit offset of src2 + i, read as is when Shifted is
+// false, or n. The blocks before it are each tested for zero as a whole,
+// which is a single vector test, and only its block is searched word by
+// word.
+template <bool Shifted, class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE std::size_t _find_any_words_shifted(
+        const T* src1, const T* src2, std::size_t n, std::size_t offset,
+        BinaryOperation op) {
+    constexpr std::size_t block = 2 * _simd_block<T>;
+    std::size_t i = 0;
+    for (; i + block <= n; i += block) {
+        T any = 0;
+        for (std::size_t j = 0; j < block; ++j) {
+            const T word = Shifted
+                ? _funnel_word(src2[i + j], src2[i + j + 1], offset)
+                : src2[i + j];
+            any |= static_cast<T>(op(src1[i + j], word));
+        }
+        if (any != 0) {
+            break;
+        }
+    }
+    for (; i < n; ++i) {
+        const T word = Shifted ? _funnel_word(src2[i], src2[i + 1], offset) : src2[i];
+        if (static_cast<T>(op(src1[i], word)) != 0) {
+            return i;
+        }
+    }
+    return n;
+}
+
+// Same as _find_any_words_shifted, where src2 needs n + 1 readable words
+// when offset is not 0
+template <class T, class BinaryOperation>
+_BITLIB_ALWAYS_INLINE std::size_t _find_any_words(
+        const T* src1, const T* src2, std::size_t n, std::size_t offset,
+        BinaryOperation op) {
+    return offset == 0
+        ? _find_any_words_shifted<false>(src1, src2, n, offset, op)
+        : _find_any_words_shifted<true>(src1, src2, n, offset, op);
+}
+
+// buffer[j] = and of the k words of the rows at position first + j, for j in
+// [0, M), and returns whether any of them is set. The rows are read in
+// order until the buffer is zero.
+template <std::size_t M, class T>
+_BITLIB_ALWAYS_INLINE bool _intersect_rows_block(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t first, T* buffer) {
+    const T* row = rows[0] + first;
+    T any = 0;
+    for (std::size_t j = 0; j < M; ++j) {
+        buffer[j] = _funnel_word(row[j], row[j + 1], offsets[0]);
+        any |= buffer[j];
+    }
+    for (std::size_t i = 1; i < k && any != 0; ++i) {
+        row = rows[i] + first;
+        any = 0;
+        for (std::size_t j = 0; j < M; ++j) {
+            buffer[j] &= _funnel_word(row[j], row[j + 1], offsets[i]);
+            any |= buffer[j];
+        }
+    }
+    return any != 0;
+}
+
+// _transform_rows_words for the and of the rows, which skips the rows left
+// for a block once it is zero. The blocks are larger, as testing one for
+// zero costs as much as combining a row of _simd_block words.
+template <class T>
+_BITLIB_ALWAYS_INLINE void _intersect_rows_words(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, T* dst) {
+    constexpr std::size_t block = 2 * _simd_block<T>;
+    std::size_t first = 0;
+    for (; first + block <= n; first += block) {
+        T buffer[block];
+        _intersect_rows_block<block>(rows, offsets, k, first, buffer);
+        for (std::size_t j = 0; j < block; ++j) {
+            dst[first + j] = buffer[j];
+        }
+    }
+    for (; first < n; ++first) {
+        T buffer[1];
+        _intersect_rows_block<1>(rows, offsets, k, first, buffer);
+        dst[first] = buffer[0];
+    }
+}
+
+// dst[first + j] is set where at least threshold of the k words of the rows
+// at position first + j are set, for j in [0, M). The ones of each position
+// are counted in Planes bit sliced counters, plane p holding bit p of the
+// count of every position, and each word is added with a chain of half
+// adders. Counts that carry out of the last plane are past threshold, and
+// are kept in saturated.
+template <std::size_t Planes, std::size_t M, class T>
+_BITLIB_ALWAYS_INLINE void _count_at_least_block(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t first, std::size_t threshold, T* dst) {
+    T planes[Planes][M] = {};
+    T saturated[M] = {};
+    for (std::size_t i = 0; i < k; ++i) {
+        const T* row = rows[i] + first;
+        for (std::size_t j = 0; j < M; ++j) {
+            T carry = _funnel_word(row[j], row[j + 1], offsets[i]);
+            for (std::size_t p = 0; p < Planes; ++p) {
+                const T next = planes[p][j] & carry;
+                planes[p][j] ^= carry;
+                carry = next;
+            }
+            saturated[j] |= carry;
+        }
+    }
+    // Compares the counts with threshold, from the most significant bit
+    for (std::size_t j = 0; j < M; ++j) {
+        T greater = saturated[j];
+        T equal = static_cast<T>(~saturated[j]);
+        for (std::size_t p = Planes; p-- > 0;) {
+            if ((threshold >> p) & 1) {
+                equal &= planes[p][j];
+            } else {
+                greater |= equal & planes[p][j];
+                equal &= static_cast<T>(~planes[p][j]);
+            }
+        }
+        dst[first + j] = static_cast<T>(greater | equal);
+    }
+}
+
+// dst[j] is set where at least threshold of the k words of the rows at
+// position j are set, for j in [0, n), with 0 < threshold. The rows are
+// laid out as in _transform_rows_words.
+template <std::size_t Planes, class T>
+_BITLIB_ALWAYS_INLINE void _count_at_least_planes(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, std::size_t threshold, T* dst) {
+    constexpr std::size_t block = _simd_block<T>;
+    std::size_t first = 0;
+    for (; first + block <= n; first += block) {
+        _count_at_least_block<Planes, block>(rows, offsets, k, first, threshold, dst);
+    }
+    for (; first < n; ++first) {
+        _count_at_least_block<Planes, 1>(rows, offsets, k, first, threshold, dst);
+    }
+}
+
+// The counters get as many planes as threshold has bits, so that they stay
+// in registers for the usual small thresholds
+template <class T>
+_BITLIB_ALWAYS_INLINE void _count_at_least_words(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, std::size_t threshold, T* dst) {
+    if (threshold < 2) {
+        _count_at_least_planes<1>(rows, offsets, k, n, threshold, dst);
+    } else if (threshold < 4) {
+        _count_at_least_planes<2>(rows, offsets, k, n, threshold, dst);
+    } else if (threshold < 8) {
+        _count_at_least_planes<3>(rows, offsets, k, n, threshold, dst);
+    } else if (threshold < 16) {
+        _count_at_least_planes<4>(rows, offsets, k, n, threshold, dst);
+    } else if (threshold < 32) {
+        _count_at_least_planes<5>(rows, offsets, k, n, threshold, dst);
+    } else if (threshold < 64) {
+        _count_at_least_planes<6>(rows, offsets, k, n, threshold, dst);
+    } else {
+        _count_at_least_planes<binary_digits<std::size_t>::value>(rows, offsets, k, n, threshold, dst);
+    }
+}
+
+// Whole 32 and 64 byte blocks go to the carry-save popcounts of libpopcnt
+template <class T, class BlockPopcount>
+_BITLIB_ALWAYS_INLINE std::size_t _popcount_words_blocked(
+        const T* p, std::size_t n, std::size_t block_bytes, BlockPopcount&& popcount_blocks) {
+    const std::size_t num_blocks = n * sizeof(T) / block_bytes;
+    const std::size_t done = num_blocks * block_bytes / sizeof(T);
+    return popcount_blocks(p, num_blocks) + _popcount_words(p + done, n - done);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- TARGET VARIANTS ------------------------------ //
+// Defines a struct of static kernels compiled with the given attributes.
+// The generic kernels are forced inline so that their loops are compiled
+// for the instruction set of the variant.
+#define _BITLIB_DEFINE_SIMD_KERNELS(NAME, ATTRIBUTES, POPCOUNT)                \
+struct NAME {                                                                  \
+    template <class T>                                                         \
+    ATTRIBUTES static std::size_t popcount(const T* p, std::size_t n) {        \
+        return POPCOUNT;                                                       \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static std::size_t find_not(const T* p, std::size_t n, T v) {   \
+        return _find_not_words(p, n, v);                                       \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static void fill(T* p, std::size_t n, T v) {                    \
+        _fill_words(p, n, v);                                                  \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void transform(const T* s, std::size_t n, T* d, Op op) { \
+        _transform_words(s, n, d, op);                                         \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void transform(                                          \
+            const T* s1, const T* s2, std::size_t n, T* d, Op op) {           \
+        _transform_words(s1, s2, n, d, op);                                    \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void transform_shrd(                                     \
+            T* d, const T* s, std::size_t n, std::size_t offset, Op op) {     \
+        _transform_shrd_words(d, s, n, offset, op);                            \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void transform_shrd2(const T* s1, std::size_t offset1,   \
+            const T* s2, std::size_t offset2, std::size_t n, T* d, Op op) {   \
+        _transform_shrd2_words(s1, offset1, s2, offset2, n, d, op);            \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void shrd_transform(const T* s1, const T* s2,            \
+            std::size_t n, std::size_t offset, T* d, Op op) {                 \
+        _shrd_transform_words(s1, s2, n, offset, d, op);                       \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static std::size_t find_any(const T* s1, const T* s2,           \
+            std::size_t n, std::size_t offset, Op op) {                        \
+        return _find_any_words(s1, s2, n, offset, op);                         \
+    }                                                                          \
+    template <class T, class Op>                                               \
+    ATTRIBUTES static void transform_rows(const T* const* rows,                \
+            const std::size_t* offsets, std::size_t k, std::size_t n, T* d,    \
+            Op op) {                                                           \
+        _transform_rows_words(rows, offsets, k, n, d, op);                     \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static void intersect_rows(const T* const* rows,                \
+            const std::size_t* offsets, std::size_t k, std::size_t n, T* d) {  \
+        _intersect_rows_words(rows, offsets, k, n, d);                         \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static void count_at_least(const T* const* rows,                \
+            const std::size_t* offsets, std::size_t k, std::size_t n,          \
+            std::size_t threshold, T* d) {                                     \
+        _count_at_least_words(rows, offsets, k, n, threshold, d);              \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static void shrd_forward(                                       \
+            T* d, const T* s, std::size_t n, std::size_t offset) {            \
+        _shrd_words_forward(d, s, n, offset);                                  \
+    }                                                                          \
+    template <class T>                                                         \
+    ATTRIBUTES static void shrd_backward(                                      \
+            T* d, const T* s, std::size_t n, std::size_t offset) {            \
+        _shrd_words_backward(d, s, n, offset);                                 \
+    }                                                                          \
+};
+
+_BITLIB_DEFINE_SIMD_KERNELS(_simd_scalar_kernels, , _popcount_words(p, n))
+
+#ifdef _BITLIB_DISPATCH_X86
+#if defined(HAVE_AVX2)
+_BITLIB_DEFINE_SIMD_KERNELS(_simd_avx2_kernels,
+    __attribute__((target("avx2,popcnt"))),
+    _popcount_words_blocked(p, n, 32, [](const T* q, std::size_t blocks) {
+        return popcnt_avx2(reinterpret_cast<const __m256i*>(q), blocks);
+    }))
+#else
+_BITLIB_DEFINE_SIMD_KERNELS(_simd_avx2_kernels,
+    __attribute__((target("avx2,popcnt"))), _popcount_words(p, n))
+#endif
+#if defined(HAVE_AVX512)
+_BITLIB_DEFINE_SIMD_KERNELS(_simd_avx512_kernels,
+    __attribute__((target("avx512f,avx512bw,popcnt"))),
+    _popcount_words_blocked(p, n, 64, [](const T* q, std::size_t blocks) {
+        return popcnt_avx512(reinterpret_cast<const __m512i*>(q), blocks);
+    }))
+#else
+_BITLIB_DEFINE_SIMD_KERNELS(_simd_avx512_kernels,
+    __attribute__((target("avx512f,avx512bw,popcnt"))), _popcount_words(p, n))
+#endif
+#endif
+#undef _BITLIB_DEFINE_SIMD_KERNELS
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------- DISPATCH --------------------------------- //
+// Calls f with the kernels of the current target
+template <class F>
+decltype(auto) _simd_dispatch(F&& f) {
+    switch (simd::current_target()) {
+#ifdef _BITLIB_DISPATCH_X86
+        case simd::target::avx512:
+            return f(_simd_avx512_kernels());
+        case simd::target::avx2:
+            return f(_simd_avx2_kernels());
+#endif
+        default:
+            return f(_simd_scalar_kernels());
+    }
+}
+
+template <class T>
+std::size_t _simd_popcount(const T* p, std::size_t n) {
+    return _simd_dispatch([&](auto kernels) {return kernels.popcount(p, n);});
+}
+
+template <class T>
+std::size_t _simd_find_not(const T* p, std::size_t n, T value) {
+    return _simd_dispatch([&](auto kernels) {return kernels.find_not(p, n, value);});
+}
+
+template <class T>
+void _simd_fill(T* p, std::size_t n, T value) {
+    _simd_dispatch([&](auto kernels) {kernels.fill(p, n, value);});
+}
+
+template <class T, class UnaryOperation>
+void _simd_transform(const T* src, std::size_t n, T* dst, UnaryOperation op) {
+    _simd_dispatch([&](auto kernels) {kernels.transform(src, n, dst, op);});
+}
+
+template <class T, class BinaryOperation>
+void _simd_transform(const T* src1, const T* src2, std::size_t n, T* dst, BinaryOperation op) {
+    _simd_dispatch([&](auto kernels) {kernels.transform(src1, src2, n, dst, op);});
+}
+
+template <class T, class BinaryOperation>
+void _simd_transform_shrd(T* dst, const T* src, std::size_t n, std::size_t offset, BinaryOperation op) {
+    _simd_dispatch([&](auto kernels) {kernels.transform_shrd(dst, src, n, offset, op);});
+}
+
+template <class T, class BinaryOperation>
+void _simd_transform_shrd2(
+        const T* src1, std::size_t offset1, const T* src2, std::size_t offset2,
+        std::size_t n, T* dst, BinaryOperation op) {
+    _simd_dispatch([&](auto kernels) {
+        kernels.transform_shrd2(src1, offset1, src2, offset2, n, dst, op);
+    });
+}
+
+template <class T, class BinaryOperation>
+void _simd_shrd_transform(
+        const T* src1, const T* src2, std::size_t n, std::size_t offset,
+        T* dst, BinaryOperation op) {
+    _simd_dispatch([&](auto kernels) {kernels.shrd_transform(src1, src2, n, offset, dst, op);});
+}
+
+template <class T, class BinaryOperation>
+std::size_t _simd_find_any(
+        const T* src1, const T* src2, std::size_t n, std::size_t offset,
+        BinaryOperation op) {
+    return _simd_dispatch([&](auto kernels) {return kernels.find_any(src1, src2, n, offset, op);});
+}
+
+template <class T, class BinaryOperation>
+void _simd_transform_rows(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, T* dst, BinaryOperation op) {
+    _simd_dispatch([&](auto kernels) {kernels.transform_rows(rows, offsets, k, n, dst, op);});
+}
+
+template <class T>
+void _simd_intersect_rows(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, T* dst) {
+    _simd_dispatch([&](auto kernels) {kernels.intersect_rows(rows, offsets, k, n, dst);});
+}
+
+template <class T>
+void _simd_count_at_least(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, std::size_t threshold, T* dst) {
+    _simd_dispatch([&](auto kernels) {
+        kernels.count_at_least(rows, offsets, k, n, threshold, dst);
+    });
+}
+
+template <class T>
+void _simd_shrd_forward(T* dst, const T* src, std::size_t n, std::size_t offset) {
+    _simd_dispatch([&](auto kernels) {kernels.shrd_forward(dst, src, n, offset);});
+}
+
+template <class T>
+void _simd_shrd_backward(T* dst, const T* src, std::size_t n, std::size_t offset) {
+    _simd_dispatch([&](auto kernels) {kernels.shrd_backward(dst, src, n, offset);});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _DISPATCH_HPP_INCLUDED
+// ========================================================================== //
@@ -16,6 +16,7 @@
 #include <math.h>
 // Project sources
 #include "bitlib/bitlib.hpp"
+#include "execution.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace bit {
@@ -36,7 +37,7 @@ constexpr bool equal(
     // Types and constants
     using dst_word_type = typename bit_iterator<RandomAccessIt2>::word_type;
     using src_word_type = typename bit_iterator<RandomAccessIt1>::word_type;
-    using word_type = dst_word_type;
+    using word_type = ::std::remove_cv_t<dst_word_type>;
     using size_type = typename bit_iterator<RandomAccessIt2>::size_type;
     constexpr size_type digits = binary_digits<word_type>::value;
 
@@ -99,6 +100,36 @@ constexpr bool equal(
 }
 // -------------------------------------------------------------------------- //
 
+// ----------------------- Parallel Equal Algorithm ------------------------- //
+// Chunks which start after a mismatch has been found are skipped
+template <class ExecutionPolicy, class RandomAccessIt1, class RandomAccessIt2>
+_enable_if_execution_policy<ExecutionPolicy, bool>
+equal(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt1> first,
+        bit_iterator<RandomAccessIt1> last,
+        bit_iterator<RandomAccessIt2> d_first
+)
+{
+    using word_type = typename bit_iterator<RandomAccessIt1>::word_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return equal(first, last, d_first);
+    }
+    std::atomic<bool> mismatch{false};
+    _parallel_for_words<word_type>(par, num_chunks, n, first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            if (!mismatch.load(std::memory_order_relaxed)
+                    && !equal(first + begin, first + end, d_first + begin)) {
+                mismatch.store(true, std::memory_order_relaxed);
+            }
+        });
+    return !mismatch.load();
+}
+// -------------------------------------------------------------------------- //
+
 
 
 // ========================================================================== //
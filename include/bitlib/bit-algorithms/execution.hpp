@@ -0,0 +1,319 @@
+// =============================== EXECUTION ================================ //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            execution.hpp
+// Description:     Execution policies and the thread pool backing the
+//                  parallel algorithm overloads
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EXECUTION_HPP_INCLUDED
+#define _EXECUTION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+// Third-party libraries
+// Including <execution> may pull in a parallel backend which must then be
+// linked against (TBB for libstdc++), so mapping the standard policies onto
+// bitlib policies is opt-in.
+#ifdef BITLIB_STD_EXECUTION
+#include <execution>
+#endif
+// Miscellaneous
+namespace bit {
+namespace execution {
+// ========================================================================== //
+
+
+
+/* ****************************** THREAD POOL ******************************* */
+//! A fixed set of worker threads running the chunks of parallel algorithms
+class thread_pool {
+    public:
+        // num_threads counts the calling thread, which takes part in every
+        // parallel_for, so num_threads - 1 workers are started
+        explicit thread_pool(std::size_t num_threads = std::thread::hardware_concurrency())
+            : stop_(false) {
+            for (std::size_t i = 1; i < num_threads; ++i) {
+                workers_.emplace_back([this]() {_worker_loop();});
+            }
+        }
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+        ~thread_pool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cv_.notify_all();
+            for (auto& worker : workers_) {
+                worker.join();
+            }
+        }
+
+        std::size_t concurrency() const noexcept {return workers_.size() + 1;}
+
+        // Calls f(0), ..., f(n - 1) and returns once all calls have
+        // completed. Calls made from inside a worker run serially, which
+        // keeps nested parallel algorithms from deadlocking the pool. If a
+        // call throws, the calls not started yet are skipped, and the first
+        // exception is rethrown on the caller once the others have returned.
+        // The standard parallel policies call std::terminate instead.
+        template <class F>
+        void parallel_for(std::size_t n, F&& f);
+
+    private:
+        std::vector<std::thread> workers_;
+        std::deque<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool stop_;
+
+        static bool& _inside_worker() noexcept {
+            static thread_local bool inside = false;
+            return inside;
+        }
+
+        void _worker_loop() {
+            _inside_worker() = true;
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this]() {return stop_ || !tasks_.empty();});
+                    if (stop_ && tasks_.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop_front();
+                }
+                task();
+            }
+        }
+};
+
+template <class F>
+void thread_pool::parallel_for(std::size_t n, F&& f) {
+    const std::size_t num_helpers = std::min(n, concurrency()) - (n != 0);
+    if (num_helpers == 0 || _inside_worker()) {
+        for (std::size_t i = 0; i < n; ++i) {
+            f(i);
+        }
+        return;
+    }
+
+    // Every participant takes the next index until none are left. The
+    // caller waits for all helpers since they refer to this stack frame,
+    // even when a call throws: run keeps the exception for the caller, and
+    // takes the indices left away from the other participants.
+    std::atomic<std::size_t> next{0};
+    std::size_t remaining = num_helpers;
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    std::exception_ptr error;
+    auto run = [&]() {
+        try {
+            for (std::size_t i = next++; i < n; i = next++) {
+                f(i);
+            }
+        } catch (...) {
+            next = n;
+            std::lock_guard<std::mutex> done_lock(done_mutex);
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    };
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t h = 0; h < num_helpers; ++h) {
+            tasks_.emplace_back([&]() {
+                run();
+                std::lock_guard<std::mutex> done_lock(done_mutex);
+                if (--remaining == 0) {
+                    done_cv.notify_one();
+                }
+            });
+        }
+    }
+    cv_.notify_all();
+    run();
+    std::unique_lock<std::mutex> done_lock(done_mutex);
+    done_cv.wait(done_lock, [&]() {return remaining == 0;});
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+// The pool used by policies which were not given one
+inline thread_pool& default_thread_pool() {
+    static thread_pool pool;
+    return pool;
+}
+/* ************************************************************************** */
+
+
+
+/* *************************** EXECUTION POLICIES *************************** */
+//! Runs the algorithm on the calling thread only
+class sequenced_policy {};
+
+//! Splits the range into chunks of at least grain() bits which are run on a
+//! thread pool, the default one unless on() was given another.
+class parallel_policy {
+    public:
+        static constexpr std::size_t default_grain = std::size_t(1) << 20;
+
+        constexpr parallel_policy() noexcept = default;
+        constexpr explicit parallel_policy(
+                thread_pool& pool,
+                std::size_t grain = default_grain) noexcept
+            : pool_(&pool), grain_(grain) {}
+
+        constexpr parallel_policy on(thread_pool& pool) const noexcept {
+            return parallel_policy(pool, grain_);
+        }
+        constexpr parallel_policy with_grain(std::size_t grain) const noexcept {
+            parallel_policy policy(*this);
+            policy.grain_ = std::max<std::size_t>(grain, 1);
+            return policy;
+        }
+
+        thread_pool& pool() const {return pool_ ? *pool_ : default_thread_pool();}
+        constexpr std::size_t grain() const noexcept {return grain_;}
+
+    private:
+        thread_pool* pool_ = nullptr;
+        std::size_t grain_ = default_grain;
+};
+
+//! Every chunk is already processed a word at a time, so there is nothing
+//! more to gain from unsequenced execution: this behaves as parallel_policy.
+class parallel_unsequenced_policy : public parallel_policy {
+    public:
+        using parallel_policy::parallel_policy;
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+template <class T>
+struct is_execution_policy : std::false_type {};
+template <>
+struct is_execution_policy<sequenced_policy> : std::true_type {};
+template <>
+struct is_execution_policy<parallel_policy> : std::true_type {};
+template <>
+struct is_execution_policy<parallel_unsequenced_policy> : std::true_type {};
+#ifdef BITLIB_STD_EXECUTION
+template <>
+struct is_execution_policy<std::execution::sequenced_policy> : std::true_type {};
+template <>
+struct is_execution_policy<std::execution::parallel_policy> : std::true_type {};
+template <>
+struct is_execution_policy<std::execution::parallel_unsequenced_policy> : std::true_type {};
+#endif
+
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+// Converts any supported policy to a parallel_policy. Sequential policies
+// get an infinite grain, so that the range is never split.
+constexpr parallel_policy _as_parallel(const parallel_policy& policy) noexcept {
+    return policy;
+}
+constexpr parallel_policy _as_parallel(const sequenced_policy&) noexcept {
+    return parallel_policy().with_grain(std::numeric_limits<std::size_t>::max());
+}
+#ifdef BITLIB_STD_EXECUTION
+constexpr parallel_policy _as_parallel(const std::execution::sequenced_policy&) noexcept {
+    return _as_parallel(seq);
+}
+constexpr parallel_policy _as_parallel(const std::execution::parallel_policy&) noexcept {
+    return par;
+}
+constexpr parallel_policy _as_parallel(const std::execution::parallel_unsequenced_policy&) noexcept {
+    return par;
+}
+#endif
+/* ************************************************************************** */
+} // namespace execution
+
+
+
+// ------------------------ PARALLEL IMPLEMENTATION ------------------------- //
+// Enables a parallel overload when ExecutionPolicy is a supported policy
+template <class ExecutionPolicy, class T>
+using _enable_if_execution_policy = typename std::enable_if<
+    execution::is_execution_policy_v<typename std::decay<ExecutionPolicy>::type>,
+    T
+>::type;
+
+// Number of chunks to split n bits into; 1 means the range should be
+// processed serially
+inline std::size_t _parallel_chunks(
+        const execution::parallel_policy& policy,
+        std::size_t n) {
+    if (n / 2 < policy.grain()) {
+        return 1;
+    }
+    return std::min(n / policy.grain(), policy.pool().concurrency());
+}
+
+// Splits [0, n) into num_chunks chunks and calls f(chunk, begin, end) for
+// each of them in parallel. Inner chunk boundaries fall on word boundaries
+// of an iterator at bit `position` of its word, so that no word of the range
+// it refers to is shared between two chunks. Empty chunks are skipped.
+// Chunks are handed out from the front of the range, or from the back if
+// reverse is set.
+template <class WordType, class F>
+void _parallel_for_words(
+        const execution::parallel_policy& policy,
+        std::size_t num_chunks,
+        std::size_t n,
+        std::size_t position,
+        F&& f,
+        bool reverse = false) {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    auto boundary = [=](std::size_t chunk) {
+        if (chunk == num_chunks) {
+            return n;
+        }
+        const std::size_t raw = chunk * (n / num_chunks);
+        const std::size_t aligned = (position + raw + digits - 1) / digits * digits - position;
+        return std::min(aligned, n);
+    };
+    policy.pool().parallel_for(num_chunks, [&](std::size_t index) {
+        const std::size_t chunk = reverse ? num_chunks - 1 - index : index;
+        const std::size_t begin = chunk == 0 ? 0 : boundary(chunk);
+        const std::size_t end = boundary(chunk + 1);
+        if (begin < end) {
+            f(chunk, begin, end);
+        }
+    });
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _EXECUTION_HPP_INCLUDED
+// ========================================================================== //
@@ -16,6 +16,8 @@
 // C++ standard library
 // Project sources
 #include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+#include "execution.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
 #include "hwy/highway.h"
@@ -73,7 +75,14 @@ void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
             hn::Store(fill_vec, d, &*it);
         }
 #endif
+#ifdef BITLIB_DISPATCH
+        const auto num_words = std::distance(it, last.base());
+        if (num_words > 0) {
+            _simd_fill<word_type>(&*it, num_words, fill_word);
+        }
+#else
         std::fill(it, last.base(), fill_word);
+#endif
         if (last.position() != 0) {
             it = last.base();
             write_word<word_type>(fill_word, bit_iterator<word_type*>(&(*it)), last.position());
@@ -81,6 +90,26 @@ void fill(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last,
     }
 }
 
+// Chunks never share a word, so plain writes are race-free
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, void>
+fill(ExecutionPolicy&& policy, bit_iterator<RandomAccessIt> first,
+    bit_iterator<RandomAccessIt> last, bit::bit_value bv) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return fill(first, last, bv);
+    }
+    _parallel_for_words<word_type>(par, num_chunks, n, first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            fill(first + begin, first + end, bv);
+        });
+}
+
+
+
 // ========================================================================== //
 } // namespace bit
 #ifdef BITLIB_HWY
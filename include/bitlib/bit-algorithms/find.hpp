@@ -9,9 +9,14 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <type_traits>
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
+#include "dispatch.hpp"
+#include "execution.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
 #include "hwy/highway.h"
@@ -99,11 +104,20 @@ constexpr bit_iterator<RandomAccessIt> find(
     }
 #endif
 
+#ifdef BITLIB_DISPATCH
+    const auto num_words = std::distance(it, last.base());
+    if (num_words > 0) {
+        using value_type = std::remove_cv_t<word_type>;
+        it += _simd_find_not<value_type>(&*it, num_words,
+                bv == bit1 ? value_type(0) : static_cast<value_type>(-1));
+    }
+#else
     if (bv == bit1) {
         it = std::find_if(it, last.base(), [](word_type a) {return a != 0;});
     } else {
         it = std::find_if(it, last.base(), [](word_type a) {return a != static_cast<word_type>(-1);});
     }
+#endif
 
     if (it != last.base()) {
         size_type num_trailing_complementary_bits = (bv == bit0)
@@ -122,6 +136,134 @@ constexpr bit_iterator<RandomAccessIt> find(
     return last;
 }
 
+// Returns an iterator to the last bit equal to bv in [first, last), or last
+// if there is none. Words are scanned from the back, and the position of the
+// hit within a word is given by its number of leading non-matching bits.
+template <class RandomAccessIt>
+constexpr bit_iterator<RandomAccessIt> find_last(
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last, bit::bit_value bv
+) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr word_type all_ones = static_cast<word_type>(-1);
+    if (first == last) {
+        return last;
+    }
+
+    // Sets the bits equal to bv, restricted to those at or after first
+    auto matching = [&](RandomAccessIt it) {
+        word_type word = bv == bit1 ? *it : static_cast<word_type>(~*it);
+        if (it == first.base()) {
+            word &= static_cast<word_type>(all_ones << first.position());
+        }
+        return word;
+    };
+    RandomAccessIt it = last.base();
+    if (last.position() != 0) {
+        const word_type word = matching(it) & static_cast<word_type>(~(all_ones << last.position()));
+        if (word) {
+            return bit_iterator<RandomAccessIt>(it, digits - 1 - _lzcnt(word));
+        }
+        if (it == first.base()) {
+            return last;
+        }
+    }
+    while (it != first.base()) {
+        --it;
+        const word_type word = matching(it);
+        if (word) {
+            return bit_iterator<RandomAccessIt>(it, digits - 1 - _lzcnt(word));
+        }
+    }
+    return last;
+}
+
+// ------------------------ Parallel Find Algorithms ------------------------ //
+// The range is split into more chunks than there are threads, and chunks are
+// handed out in the order of the search. The best hit so far is published
+// through an atomic: a chunk is scanned one grain at a time and abandoned as
+// soon as a better hit is known, so little work is done past the answer.
+// find scans a default grain in under 2 us, about what waking the pool
+// costs, so it only goes parallel from _parallel_find_grains grains on.
+constexpr std::size_t _parallel_find_grains = 16;
+
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+find(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last, bit::bit_value bv
+) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    if (n / _parallel_find_grains < par.grain() || _parallel_chunks(par, n) <= 1) {
+        return find(first, last, bv);
+    }
+    const std::size_t step = par.grain();
+    const std::size_t num_chunks = std::min(n / step, 8 * par.pool().concurrency());
+    // Index of the first hit found so far
+    std::atomic<std::size_t> best{n};
+    _parallel_for_words<word_type>(par, num_chunks, n, first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t block = begin; block < end; block += step) {
+                if (block >= best.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                const auto block_last = first + std::min(end, block + step);
+                const auto it = find(first + block, block_last, bv);
+                if (it != block_last) {
+                    const std::size_t hit = distance(first, it);
+                    std::size_t current = best.load(std::memory_order_relaxed);
+                    while (hit < current && !best.compare_exchange_weak(current, hit)) {}
+                    return;
+                }
+            }
+        });
+    return first + best.load();
+}
+
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+find_last(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last, bit::bit_value bv
+) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    if (n / _parallel_find_grains < par.grain() || _parallel_chunks(par, n) <= 1) {
+        return find_last(first, last, bv);
+    }
+    const std::size_t step = par.grain();
+    const std::size_t num_chunks = std::min(n / step, 8 * par.pool().concurrency());
+    // One past the index of the last hit found so far, 0 if none
+    std::atomic<std::size_t> best{0};
+    _parallel_for_words<word_type>(par, num_chunks, n, first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            for (std::size_t block = end; block > begin; block -= std::min(step, block - begin)) {
+                if (block <= best.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                const auto block_first = first + (block - std::min(step, block - begin));
+                const auto block_last = first + block;
+                const auto it = find_last(block_first, block_last, bv);
+                if (it != block_last) {
+                    const std::size_t hit = distance(first, it) + 1;
+                    std::size_t current = best.load(std::memory_order_relaxed);
+                    while (hit > current && !best.compare_exchange_weak(current, hit)) {}
+                    return;
+                }
+            }
+        }, true);
+    const std::size_t hit = best.load();
+    return hit ? first + (hit - 1) : last;
+}
+// -------------------------------------------------------------------------- //
+
 // ========================================================================== //
 } // namespace bit
 #ifdef BITLIB_HWY
@@ -0,0 +1,118 @@
+// ================================ FIND RUN ================================ //
+// Project: The Experimental Bit Algorithms Library
+// Description: Search for n consecutive bits of a given value
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _FIND_RUN_HPP_INCLUDED
+#define _FIND_RUN_HPP_INCLUDED
+// ========================================================================== //
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// Bit i of the result is set iff bits [i, i + n) of src are all set.
+// Each step extends the encoded run length by up to itself, so only
+// O(log n) shifts are needed. Requires 0 < n <= digits.
+template <class T>
+constexpr T _run_starts(T src, std::size_t n) noexcept {
+    std::size_t len = 1;
+    while (len < n && src) {
+        const std::size_t shift = std::min(len, n - len);
+        src &= static_cast<T>(src >> shift);
+        len += shift;
+    }
+    return src;
+}
+
+// Returns an iterator to the first bit of the first run of n consecutive bits
+// equal to bv in [first, last), or last if there is no such run.
+//
+// The range is scanned a word at a time. The length of the run of matching
+// bits ending at the top of the previous words is carried over; it is
+// extended by the trailing matching bits of the next word (tzcnt), and reset
+// to the leading matching bits (lzcnt) whenever a word contains a mismatch.
+// Runs shorter than a word which lie inside one word are found by folding the
+// word onto itself with shifted ANDs.
+template <class RandomAccessIt>
+constexpr bit_iterator<RandomAccessIt> find_run(
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last,
+        bit::bit_value bv,
+        typename bit_iterator<RandomAccessIt>::size_type n
+) {
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr word_type all_ones = static_cast<word_type>(-1);
+
+    // Special cases
+    if (n == 0) {
+        return first;
+    }
+    if (static_cast<size_type>(distance(first, last)) < n) {
+        return last;
+    }
+
+    // Initialization
+    const bit_iterator<RandomAccessIt> origin(first.base(), 0);
+    const RandomAccessIt last_word = std::next(last.base(), last.position() != 0);
+    size_type offset = 0;
+    size_type run = 0;
+
+    // Computation
+    for (RandomAccessIt it = first.base(); it != last_word; ++it, offset += digits) {
+        // Set the matching bits, then clear those outside of the range
+        word_type word = bv == bit1 ? *it : static_cast<word_type>(~*it);
+        if (it == first.base()) {
+            word &= static_cast<word_type>(all_ones << first.position());
+        }
+        if (it == last.base()) {
+            word &= static_cast<word_type>(~(all_ones << last.position()));
+        }
+        if (word == all_ones) {
+            run += digits;
+            if (run >= n) {
+                return origin + (offset + digits - run);
+            }
+            continue;
+        }
+        // Runs crossing into this word from the previous ones
+        const size_type trailing = _tzcnt(static_cast<word_type>(~word));
+        if (run + trailing >= n) {
+            return origin + (offset - run);
+        }
+        // Runs lying strictly inside this word
+        if (n < digits) {
+            const word_type starts = _run_starts(word, n);
+            if (starts) {
+                return origin + (offset + _tzcnt(starts));
+            }
+        }
+        run = _lzcnt(static_cast<word_type>(~word));
+    }
+    return last;
+}
+// ========================================================================== //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _FIND_RUN_HPP_INCLUDED
+// ========================================================================== //
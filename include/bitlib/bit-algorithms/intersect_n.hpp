@@ -0,0 +1,173 @@
+// ============================== INTERSECT N =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            intersect_n.hpp
+// Description:     Intersection of many bit ranges, which skips the inputs
+//                  left for the blocks of words already empty
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _INTERSECT_N_HPP_INCLUDED
+#define _INTERSECT_N_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "count.hpp"
+#include "dispatch.hpp"
+#include "find.hpp"
+#include "transform_n.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// --------------------------- INTERSECT N: DETAILS ------------------------- //
+// The word operation of the intersections for _transform_n. The block form
+// reads the inputs in order, and stops at the first one that leaves a
+// block of words empty.
+struct _bit_intersection {
+    template <class T>
+    constexpr T operator()(const T* words, std::size_t k) const noexcept {
+        T result = static_cast<T>(-1);
+        for (std::size_t i = 0; i < k && result != 0; ++i) {
+            result &= words[i];
+        }
+        return result;
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+#ifdef BITLIB_DISPATCH
+        _simd_intersect_rows<T>(rows, offsets, k, n, dst);
+#else
+        _intersect_rows_words(rows, offsets, k, n, dst);
+#endif
+    }
+};
+
+// Ones in a sample of the words of the len bits starting at first, as an
+// estimate of its density
+template <class InputIt>
+std::size_t _sample_ones(InputIt first, std::size_t len) {
+    using word_type = std::remove_cv_t<typename InputIt::word_type>;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    constexpr std::size_t samples = 16;
+    const std::size_t num_words = len / digits;
+    const std::size_t stride = std::max<std::size_t>(num_words / samples, 1);
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < std::min(num_words, samples); ++i) {
+        ones += _popcnt(get_word<word_type>(first + i * stride * digits, digits));
+    }
+    return ones;
+}
+
+// The beginnings of the inputs and their size, as _begin_inputs, sparsest
+// first so that the blocks of words get empty after reading as few of them
+// as possible
+template <class Inputs>
+auto _begin_inputs_by_density(const Inputs& inputs) {
+    auto inputs_begin = _begin_inputs(inputs);
+    auto& firsts = inputs_begin.first;
+    const std::size_t total_bits = inputs_begin.second;
+    std::vector<std::pair<std::size_t, std::size_t>> order;
+    for (std::size_t i = 0; i < firsts.size(); ++i) {
+        order.emplace_back(_sample_ones(firsts[i], total_bits), i);
+    }
+    std::stable_sort(order.begin(), order.end());
+    auto sorted = firsts;
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        sorted[i] = firsts[order[i].second];
+    }
+    firsts = std::move(sorted);
+    return inputs_begin;
+}
+
+// Computes the intersection a chunk of words at a time, and passes each
+// chunk to visit(first, last) until it returns false
+template <class Inputs, class Visitor>
+void _intersect_chunks(const Inputs& inputs, Visitor visit) {
+    using input_iterator = decltype(std::begin(*std::begin(inputs)));
+    using word_type = std::remove_cv_t<typename input_iterator::word_type>;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    constexpr std::size_t chunk_words = 8192 / sizeof(word_type);
+    auto [firsts, total_bits] = _begin_inputs_by_density(inputs);
+    word_type chunk[chunk_words] = {};
+    const bit_iterator<word_type*> chunk_first(chunk);
+    _bit_intersection op;
+    std::size_t remaining = total_bits;
+    while (remaining > 0) {
+        const std::size_t len = std::min(remaining, chunk_words * digits);
+        _transform_n(firsts, len, chunk_first, op);
+        if (!visit(chunk_first, chunk_first + len)) return;
+        remaining -= len;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------- INTERSECT N ------------------------------ //
+// Writes the bits set in all the ranges of inputs to the range starting at
+// d_first, and returns its end. inputs is a container of bit ranges as for
+// transform_n, such as bit spans. As there, d_first may be the beginning of
+// any of the inputs, whatever the order they are read in, but the output
+// may not otherwise overlap them. The sparsest inputs, by a sample of their
+// words, are read first, and the inputs left for a block of words are not
+// read once it is empty.
+template <class Inputs, class RandomAccessIt>
+bit_iterator<RandomAccessIt> intersect_n(
+        const Inputs& inputs,
+        bit_iterator<RandomAccessIt> d_first) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    using input_iterator = decltype(std::begin(*std::begin(inputs)));
+    static_assert(std::is_same<
+            word_type,
+            std::remove_cv_t<typename input_iterator::word_type>
+        >::value, "intersect_n combines ranges of the same word type");
+    auto [firsts, total_bits] = _begin_inputs_by_density(inputs);
+    _bit_intersection op;
+    return _transform_n(firsts, total_bits, d_first, op);
+}
+
+// Number of bits set in all the ranges of inputs, without storing the
+// intersection
+template <class Inputs>
+std::size_t intersect_count(const Inputs& inputs) {
+    std::size_t ones = 0;
+    _intersect_chunks(inputs, [&ones](auto first, auto last) {
+        ones += count(first, last, bit1);
+        return true;
+    });
+    return ones;
+}
+
+// Whether a bit is set in all the ranges of inputs. Stops at the first
+// chunk of words of the intersection that is not empty.
+template <class Inputs>
+bool intersect_any(const Inputs& inputs) {
+    bool any = false;
+    _intersect_chunks(inputs, [&any](auto first, auto last) {
+        any = find(first, last, bit1) != last;
+        return !any;
+    });
+    return any;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _INTERSECT_N_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,137 @@
+// ================================ MISMATCH ================================ //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            mismatch.hpp
+// Description:     First difference between two bit ranges, and their
+//                  lexicographical comparison, a word at a time
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _MISMATCH_HPP_INCLUDED
+#define _MISMATCH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// -------------------------------- MISMATCH -------------------------------- //
+// Returns the first bit of [first1, last1) that differs from the matching bit
+// of the range starting at first2, and that matching bit, or last1 and the
+// end of the second range when there is none. The ranges are compared a word
+// at a time, as in transform_assign: the words that differ are found by
+// their xor, and the bit within the word by counting its trailing zeros.
+template <class RandomAccessIt1, class RandomAccessIt2>
+constexpr std::pair<bit_iterator<RandomAccessIt1>, bit_iterator<RandomAccessIt2>>
+mismatch(
+        bit_iterator<RandomAccessIt1> first1,
+        bit_iterator<RandomAccessIt1> last1,
+        bit_iterator<RandomAccessIt2> first2) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>;
+    using size_type = typename bit_iterator<RandomAccessIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+            word_type,
+            std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>
+        >::value, "mismatch compares ranges of the same word type");
+
+    // Assertions
+    _assert_range_viability(first1, last1);
+    if (first1 == last1) return {first1, first2};
+
+    // Initialization
+    size_type remaining = distance(first1, last1);
+    size_type done = 0;
+    auto it = first1.base();
+    auto s_first = first2;
+    auto found = [&](word_type diff) {
+        const size_type pos = done + _tzcnt(diff);
+        return std::make_pair(first1 + pos, first2 + pos);
+    };
+
+    // Partial first word of the first range
+    if (first1.position() != 0) {
+        const size_type partial = std::min<size_type>(remaining, digits - first1.position());
+        const word_type mask = static_cast<word_type>((static_cast<word_type>(1) << partial) - 1);
+        const word_type diff = static_cast<word_type>(
+                ((*it >> first1.position()) ^ get_word<word_type>(s_first, partial)) & mask);
+        if (diff != 0) return found(diff);
+        remaining -= partial;
+        done += partial;
+        advance(s_first, partial);
+        ++it;
+    }
+
+    // Whole words of the first range. The second one spans one more word
+    // when it is not aligned, as some bits of the range always follow its
+    // last whole word.
+    const size_type num_words = remaining / digits;
+    if (num_words > 0) {
+#ifdef BITLIB_DISPATCH
+        const size_type i = _simd_find_any<word_type>(
+                &*it, &*s_first.base(), num_words, s_first.position(), std::bit_xor<word_type>());
+#else
+        const size_type i = _find_any_words(
+                &*it, &*s_first.base(), num_words, s_first.position(), std::bit_xor<word_type>());
+#endif
+        if (i != num_words) {
+            done += i * digits;
+            return found(static_cast<word_type>(
+                    it[i] ^ get_word<word_type>(s_first + i * digits, digits)));
+        }
+        it += num_words;
+        advance(s_first, num_words * digits);
+        remaining -= num_words * digits;
+        done += num_words * digits;
+    }
+
+    // Partial last word
+    if (remaining > 0) {
+        const word_type mask = static_cast<word_type>((static_cast<word_type>(1) << remaining) - 1);
+        const word_type diff = static_cast<word_type>(
+                (*it ^ get_word<word_type>(s_first, remaining)) & mask);
+        if (diff != 0) return found(diff);
+        done += remaining;
+    }
+    return {last1, first2 + done};
+}
+
+// Whether [first1, last1) comes before [first2, last2) in lexicographical
+// order, a zero bit coming before a one bit, from their first mismatch
+template <class RandomAccessIt1, class RandomAccessIt2>
+constexpr bool lexicographical_compare(
+        bit_iterator<RandomAccessIt1> first1,
+        bit_iterator<RandomAccessIt1> last1,
+        bit_iterator<RandomAccessIt2> first2,
+        bit_iterator<RandomAccessIt2> last2) {
+    const auto size1 = distance(first1, last1);
+    const auto size2 = distance(first2, last2);
+    const auto last = first1 + std::min<decltype(size1)>(size1, size2);
+    const auto mismatches = mismatch(first1, last, first2);
+    if (mismatches.first != last) {
+        return *mismatches.first == bit0;
+    }
+    return size1 < size2;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _MISMATCH_HPP_INCLUDED
+// ========================================================================== //
@@ -14,8 +14,10 @@
 // ============================== PREAMBLE ================================== //
 // C++ standard library
 #include <iostream>
+#include <vector>
 // Project sources
 #include "bit_algorithm.hpp"
+#include "execution.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace bit {
@@ -257,6 +259,41 @@ bit_iterator<ForwardIt> rotate(
     );
 }
 
+// Parallel rotate: the shorter side is set aside in a buffer of at most half
+// the range, the rest is moved with a parallel shift, and the buffer is
+// copied back into place.
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+rotate(
+   ExecutionPolicy&& policy,
+   bit_iterator<RandomAccessIt> first,
+   bit_iterator<RandomAccessIt> n_first,
+   bit_iterator<RandomAccessIt> last
+) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using buffer_iterator = bit_iterator<typename std::vector<word_type>::iterator>;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t d = distance(first, last);
+    if (first == n_first || n_first == last || _parallel_chunks(par, d) <= 1) {
+        return rotate(first, n_first, last);
+    }
+    const std::size_t k = distance(first, n_first);
+    const std::size_t p = d - k;
+    std::vector<word_type> buffer((std::min(k, p) + digits - 1) / digits);
+    const buffer_iterator buf(buffer.begin());
+    if (k <= p) {
+        copy(par, first, n_first, buf);
+        const auto new_last = shift_left(par, first, last, k);
+        copy(par, buf, buf + k, new_last);
+        return new_last;
+    }
+    copy(par, n_first, last, buf);
+    shift_right(par, first, last, p);
+    copy(par, buf, buf + p, first);
+    return first + p;
+}
+
 
 // ========================================================================== //
 } // namespace bit
@@ -0,0 +1,157 @@
+// ============================= SET PREDICATES ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            set_predicates.hpp
+// Description:     Subset, disjointness and emptiness tests of bit ranges,
+//                  which stop at the first word that decides them
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SET_PREDICATES_HPP_INCLUDED
+#define _SET_PREDICATES_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+#include "find.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// ------------------------- SET PREDICATES: DETAILS ------------------------ //
+// Whether binary_op(d, s) is set for some bit d of [first, last), where s is
+// the matching bit of the range starting at s_first. The ranges are read a
+// word at a time, as in transform_assign, up to the first block of words
+// where it is.
+template <class RandomAccessIt1, class RandomAccessIt2, class BinaryOperation>
+constexpr bool _test_any(
+        bit_iterator<RandomAccessIt1> first,
+        bit_iterator<RandomAccessIt1> last,
+        bit_iterator<RandomAccessIt2> s_first,
+        BinaryOperation binary_op) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>;
+    using size_type = typename bit_iterator<RandomAccessIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+            word_type,
+            std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>
+        >::value, "set predicates compare ranges of the same word type");
+    auto op = [&binary_op](word_type lhs, word_type rhs) {
+        return static_cast<word_type>(binary_op(lhs, rhs));
+    };
+
+    // Assertions
+    _assert_range_viability(first, last);
+    if (first == last) return false;
+
+    // Initialization
+    size_type remaining = distance(first, last);
+    auto it = first.base();
+
+    // Partial first word of the first range
+    if (first.position() != 0) {
+        const size_type partial = std::min<size_type>(remaining, digits - first.position());
+        const word_type mask = static_cast<word_type>(
+                ((static_cast<word_type>(1) << partial) - 1) << first.position());
+        const word_type word = static_cast<word_type>(
+                get_word<word_type>(s_first, partial) << first.position());
+        if ((op(*it, word) & mask) != 0) return true;
+        remaining -= partial;
+        advance(s_first, partial);
+        ++it;
+    }
+
+    // Whole words of the first range. The second one spans one more word
+    // when it is not aligned, as some bits of the range always follow its
+    // last whole word.
+    const size_type num_words = remaining / digits;
+    if (num_words > 0) {
+#ifdef BITLIB_DISPATCH
+        const size_type found = _simd_find_any<word_type>(
+                &*it, &*s_first.base(), num_words, s_first.position(), op);
+#else
+        const size_type found = _find_any_words(
+                &*it, &*s_first.base(), num_words, s_first.position(), op);
+#endif
+        if (found != num_words) return true;
+        it += num_words;
+        advance(s_first, num_words * digits);
+        remaining -= num_words * digits;
+    }
+
+    // Partial last word
+    const word_type mask = static_cast<word_type>((static_cast<word_type>(1) << remaining) - 1);
+    return remaining > 0 && (op(*it, get_word<word_type>(s_first, remaining)) & mask) != 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------------- SET PREDICATES ----------------------------- //
+// Whether every bit set in [first1, last1) is also set in the range starting
+// at first2, stopping at the first block of words with a bit that is not
+template <class RandomAccessIt1, class RandomAccessIt2>
+constexpr bool is_subset_of(
+        bit_iterator<RandomAccessIt1> first1,
+        bit_iterator<RandomAccessIt1> last1,
+        bit_iterator<RandomAccessIt2> first2) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>;
+    return !_test_any(first1, last1, first2, bit_andnot<word_type>());
+}
+
+// Whether no bit is set in both [first1, last1) and the range starting at
+// first2, stopping at the first block of words with one that is
+template <class RandomAccessIt1, class RandomAccessIt2>
+constexpr bool is_disjoint(
+        bit_iterator<RandomAccessIt1> first1,
+        bit_iterator<RandomAccessIt1> last1,
+        bit_iterator<RandomAccessIt2> first2) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt1>::word_type>;
+    return !_test_any(first1, last1, first2, std::bit_and<word_type>());
+}
+
+// Whether some bit is set in both [first1, last1) and the range starting at
+// first2
+template <class RandomAccessIt1, class RandomAccessIt2>
+constexpr bool intersects(
+        bit_iterator<RandomAccessIt1> first1,
+        bit_iterator<RandomAccessIt1> last1,
+        bit_iterator<RandomAccessIt2> first2) {
+    return !is_disjoint(first1, last1, first2);
+}
+
+// Whether some, every or no bit of [first, last) is set, through the word
+// search of find
+template <class RandomAccessIt>
+constexpr bool any(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last) {
+    return find(first, last, bit1) != last;
+}
+
+template <class RandomAccessIt>
+constexpr bool all(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last) {
+    return find(first, last, bit0) == last;
+}
+
+template <class RandomAccessIt>
+constexpr bool none(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last) {
+    return !any(first, last);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _SET_PREDICATES_HPP_INCLUDED
+// ========================================================================== //
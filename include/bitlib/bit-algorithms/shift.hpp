@@ -14,7 +14,10 @@
 // C++ standard library
 #include <algorithm>
 #include <iterator>
+#include <vector>
 // Project sources
+#include "dispatch.hpp"
+#include "execution.hpp"
 // Third-party libraries
 #ifdef BITLIB_HWY
 #include "hwy/highway.h"
@@ -204,6 +207,14 @@ bit_iterator<RandomAccessIt> shift_left(
     auto first_base = first.base();
     auto middle_base = middle.base();
 
+#ifdef BITLIB_DISPATCH
+    const auto num_words = std::distance(middle_base, last.base()) - 1;
+    if (num_words > 0) {
+        _simd_shrd_forward<word_type>(&*first_base, &*middle_base, num_words, offset);
+        first_base += num_words;
+        middle_base += num_words;
+    }
+#endif
     while (std::next(middle_base) < last.base()) {
         *first_base = _shrd<word_type>(*middle_base, *std::next(middle_base), offset);
         first_base++;
@@ -344,6 +355,18 @@ bit_iterator<RandomAccessIt> shift_right(
         auto last_base_prev   = std::prev(last.base());
         auto middle_base_prev = std::prev(middle.base());
 
+#ifdef BITLIB_DISPATCH
+        const auto num_words = std::distance(first.base(), middle_base_prev);
+        if (num_words > 0) {
+            _simd_shrd_backward<word_type>(
+                    &*(last_base_prev - num_words + 1),
+                    &*(middle_base_prev - num_words + 1),
+                    num_words,
+                    offset);
+            last_base_prev -= num_words;
+            middle_base_prev -= num_words;
+        }
+#endif
         while (middle_base_prev > first.base()) {
             *last_base_prev = _shrd<word_type>(*middle_base_prev, *std::next(middle_base_prev), offset);
             last_base_prev--;
@@ -379,6 +402,113 @@ bit_iterator<RandomAccessIt> shift_right(
 
 
 
+// ----------------------- Parallel Shift Algorithms ------------------------ //
+// The range is split into word-aligned regions which are each longer than
+// 2n bits. Every region is shifted in place independently; only the n bits
+// which cross into it from the neighbouring region are missing afterwards.
+// Those carries are saved before any region is modified, and written into
+// the seams once the region has been shifted. If the source and destination
+// do not overlap at all, the shift is a parallel copy.
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+shift_left(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last,
+        typename bit_iterator<RandomAccessIt>::difference_type n
+) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using buffer_iterator = bit_iterator<typename std::vector<word_type>::iterator>;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const auto d = bit::distance(first, last);
+    if (n <= 0) return last;
+    if (n >= d) return first;
+    if (n >= d - n) {
+        return copy(par, first + n, last, first);
+    }
+    const std::size_t num_chunks = std::min<std::size_t>(
+            _parallel_chunks(par, d),
+            d / (2 * n + digits));
+    if (num_chunks <= 1) {
+        return shift_left(first, last, n);
+    }
+
+    // Each region except the last is completed by the first n bits of the
+    // region following it
+    const std::size_t carry_words = (n + digits - 1) / digits;
+    std::vector<word_type> carries(num_chunks * carry_words);
+    auto carry = [&](std::size_t chunk) {
+        return buffer_iterator(carries.begin() + chunk * carry_words);
+    };
+    _parallel_for_words<word_type>(par, num_chunks, d, first.position(),
+        [&](std::size_t chunk, std::size_t, std::size_t end) {
+            if (end < static_cast<std::size_t>(d)) {
+                copy(first + end, first + end + n, carry(chunk));
+            }
+        });
+    _parallel_for_words<word_type>(par, num_chunks, d, first.position(),
+        [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            shift_left(first + begin, first + end, n);
+            if (end < static_cast<std::size_t>(d)) {
+                copy(carry(chunk), carry(chunk) + n, first + end - n);
+            }
+        });
+    return first + (d - n);
+}
+
+template <class ExecutionPolicy, class RandomAccessIt>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+shift_right(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last,
+        typename bit_iterator<RandomAccessIt>::difference_type n
+) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    using buffer_iterator = bit_iterator<typename std::vector<word_type>::iterator>;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const auto d = bit::distance(first, last);
+    if (n <= 0) return first;
+    if (n >= d) return last;
+    if (n >= d - n) {
+        copy(par, first, first + (d - n), first + n);
+        return first + n;
+    }
+    const std::size_t num_chunks = std::min<std::size_t>(
+            _parallel_chunks(par, d),
+            d / (2 * n + digits));
+    if (num_chunks <= 1) {
+        return shift_right(first, last, n);
+    }
+
+    // Each region except the first is completed by the last n bits of the
+    // region preceding it
+    const std::size_t carry_words = (n + digits - 1) / digits;
+    std::vector<word_type> carries(num_chunks * carry_words);
+    auto carry = [&](std::size_t chunk) {
+        return buffer_iterator(carries.begin() + chunk * carry_words);
+    };
+    _parallel_for_words<word_type>(par, num_chunks, d, first.position(),
+        [&](std::size_t chunk, std::size_t begin, std::size_t) {
+            if (begin > 0) {
+                copy(first + (begin - n), first + begin, carry(chunk));
+            }
+        });
+    _parallel_for_words<word_type>(par, num_chunks, d, first.position(),
+        [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+            shift_right(first + begin, first + end, n);
+            if (begin > 0) {
+                copy(carry(chunk), carry(chunk) + n, first + begin);
+            }
+        });
+    return first + n;
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // ========================================================================== //
 } // namespace bit
 #ifdef BITLIB_HWY
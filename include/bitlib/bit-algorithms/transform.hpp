@@ -14,6 +14,9 @@
 #include <type_traits>
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+#include "execution.hpp"
 // Third-party libraries
 // Miscellaneous
 
@@ -103,7 +106,14 @@ constexpr bit_iterator<RandomAccessIt> transform(
             }
 #endif
             size_t std_dist = ::std::distance(firstIt, last.base());
+#ifdef BITLIB_DISPATCH
+            if (std_dist > 0) {
+                _simd_transform<std::remove_cv_t<word_type>>(&*firstIt, std_dist, &*it, unary_op);
+            }
+            it += std_dist;
+#else
             it = std::transform(firstIt, last.base(), it, unary_op);
+#endif
             firstIt += std_dist;
             first = bit_iterator<RandomAccessIt>(firstIt);
             remaining_bits_to_op -= digits * N;
@@ -181,20 +191,56 @@ constexpr bit_iterator<RandomAccessIt> transform(
         // d_first will be aligned at this point
         if (is_first1_aligned && is_first2_aligned && remaining_bits_to_op > digits) {
             auto N = ::std::distance(first1.base(), last1.base());
+#ifdef BITLIB_DISPATCH
+            if (N > 0) {
+                _simd_transform<std::remove_cv_t<word_type>>(
+                        &*first1.base(), &*first2.base(), N, &*it, binary_op);
+            }
+            it += N;
+#else
             it = std::transform(first1.base(), last1.base(), first2.base(), it, binary_op);
+#endif
             first1 += digits * N;
             first2 += digits * N;
             remaining_bits_to_op -= digits * N;
-        } else {
-            while (remaining_bits_to_op >= digits) {
-                *it = binary_op(
-                        get_word<word_type>(first1, digits),
-                        get_word<word_type>(first2, digits));
-                remaining_bits_to_op -= digits;
-                it++;
-                advance(first1, digits);
-                advance(first2, digits);
+        } else if (remaining_bits_to_op > digits) {
+            // The words of the sources are funnel shifted into place as they
+            // are read, which reads the word after each of them. That word
+            // is part of the range for all the words but the last one, which
+            // is left to the loop below.
+            const size_type N = (remaining_bits_to_op - 1) / digits;
+            const size_type offset1 = first1.position();
+            const size_type offset2 = first2.position();
+            auto src1 = &*first1.base();
+            auto src2 = &*first2.base();
+            if (_is_bitwise_operation<BinaryOperation>::value && offset1 == offset2) {
+#ifdef BITLIB_DISPATCH
+                _simd_shrd_transform<std::remove_cv_t<word_type>>(
+                        src1, src2, N, offset1, &*it, binary_op);
+#else
+                _shrd_transform_words(src1, src2, N, offset1, &*it, binary_op);
+#endif
+            } else {
+#ifdef BITLIB_DISPATCH
+                _simd_transform_shrd2<std::remove_cv_t<word_type>>(
+                        src1, offset1, src2, offset2, N, &*it, binary_op);
+#else
+                _transform_shrd2_words(src1, offset1, src2, offset2, N, &*it, binary_op);
+#endif
             }
+            it += N;
+            advance(first1, digits * N);
+            advance(first2, digits * N);
+            remaining_bits_to_op -= digits * N;
+        }
+        while (remaining_bits_to_op >= digits) {
+            *it = binary_op(
+                    get_word<word_type>(first1, digits),
+                    get_word<word_type>(first2, digits));
+            remaining_bits_to_op -= digits;
+            it++;
+            advance(first1, digits);
+            advance(first2, digits);
         }
         if (remaining_bits_to_op > 0) {
             *it = _bitblend(
@@ -292,6 +338,54 @@ constexpr bit_iterator<RandomAccessIt> transform(
     //return d_first;
 //}
 
+// Parallel overloads split on the word boundaries of the destination, so
+// that no destination word is written by two threads
+template <class ExecutionPolicy, class RandomAccessIt, class UnaryOperation>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+transform(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last,
+        bit_iterator<RandomAccessIt> d_first,
+        UnaryOperation unary_op) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first, last);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return transform(first, last, d_first, unary_op);
+    }
+    _parallel_for_words<word_type>(par, num_chunks, n, d_first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            transform(first + begin, first + end, d_first + begin, unary_op);
+        });
+    return d_first + n;
+}
+
+template <class ExecutionPolicy, class RandomAccessIt, class BinaryOperation>
+_enable_if_execution_policy<ExecutionPolicy, bit_iterator<RandomAccessIt>>
+transform(
+        ExecutionPolicy&& policy,
+        bit_iterator<RandomAccessIt> first1,
+        bit_iterator<RandomAccessIt> last1,
+        bit_iterator<RandomAccessIt> first2,
+        bit_iterator<RandomAccessIt> d_first,
+        BinaryOperation binary_op) {
+    using word_type = typename bit_iterator<RandomAccessIt>::word_type;
+    const execution::parallel_policy par = execution::_as_parallel(policy);
+    const std::size_t n = distance(first1, last1);
+    const std::size_t num_chunks = _parallel_chunks(par, n);
+    if (num_chunks <= 1) {
+        return transform(first1, last1, first2, d_first, binary_op);
+    }
+    _parallel_for_words<word_type>(par, num_chunks, n, d_first.position(),
+        [&](std::size_t, std::size_t begin, std::size_t end) {
+            transform(first1 + begin, first1 + end, first2 + begin, d_first + begin, binary_op);
+        });
+    return d_first + n;
+}
+
+
 
 // ========================================================================== //
 } // namespace bit
@@ -0,0 +1,116 @@
+// ============================ TRANSFORM ASSIGN ============================ //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            transform_assign.hpp
+// Description:     In place combination of a bit range with another one,
+//                  the range form of &=, |=, ^= and -=
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TRANSFORM_ASSIGN_HPP_INCLUDED
+#define _TRANSFORM_ASSIGN_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// Replaces every bit d of [first, last) by binary_op(d, s), where s is the
+// matching bit of the range starting at s_first, and returns last. The word
+// operation sees whole words of both ranges: when they start at the same
+// position in their words it runs on the words in place, through the SIMD
+// kernels, and otherwise the words of the source are funnel shifted into
+// place as they are read. s_first may be first, but the ranges may not
+// otherwise overlap.
+template <class RandomAccessIt1, class RandomAccessIt2, class BinaryOperation>
+constexpr bit_iterator<RandomAccessIt1> transform_assign(
+        bit_iterator<RandomAccessIt1> first,
+        bit_iterator<RandomAccessIt1> last,
+        bit_iterator<RandomAccessIt2> s_first,
+        BinaryOperation binary_op) {
+    using word_type = typename bit_iterator<RandomAccessIt1>::word_type;
+    using size_type = typename bit_iterator<RandomAccessIt1>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    static_assert(std::is_same<
+            std::remove_cv_t<word_type>,
+            std::remove_cv_t<typename bit_iterator<RandomAccessIt2>::word_type>
+        >::value, "transform_assign combines ranges of the same word type");
+    auto op = [&binary_op](word_type lhs, word_type rhs) {
+        return static_cast<word_type>(binary_op(lhs, rhs));
+    };
+
+    // Assertions
+    _assert_range_viability(first, last);
+    if (first == last) return last;
+
+    // Initialization
+    size_type remaining = distance(first, last);
+    auto it = first.base();
+
+    // Partial first word of the destination
+    if (first.position() != 0) {
+        const size_type partial = std::min<size_type>(remaining, digits - first.position());
+        *it = _bitblend(
+                *it,
+                op(*it, static_cast<word_type>(
+                    get_word<word_type>(s_first, partial) << first.position())),
+                static_cast<word_type>(first.position()),
+                static_cast<word_type>(partial));
+        remaining -= partial;
+        advance(s_first, partial);
+        ++it;
+    }
+
+    // Whole words of the destination
+    const size_type num_words = remaining / digits;
+    if (num_words > 0) {
+        auto src = s_first.base();
+        if (s_first.position() == 0) {
+#ifdef BITLIB_DISPATCH
+            _simd_transform<std::remove_cv_t<word_type>>(&*it, &*src, num_words, &*it, op);
+#else
+            std::transform(it, it + num_words, src, it, op);
+#endif
+        } else {
+            // The source spans one more word than the destination, as some
+            // bits of the range always follow its last whole word
+#ifdef BITLIB_DISPATCH
+            _simd_transform_shrd<std::remove_cv_t<word_type>>(
+                    &*it, &*src, num_words, s_first.position(), op);
+#else
+            _transform_shrd_words(&*it, &*src, num_words, s_first.position(), op);
+#endif
+        }
+        it += num_words;
+        advance(s_first, num_words * digits);
+        remaining -= num_words * digits;
+    }
+
+    // Partial last word
+    if (remaining > 0) {
+        *it = _bitblend(
+                *it,
+                op(*it, get_word<word_type>(s_first, remaining)),
+                static_cast<word_type>((static_cast<word_type>(1) << remaining) - 1));
+    }
+    return last;
+}
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _TRANSFORM_ASSIGN_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,343 @@
+// ============================== TRANSFORM N =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            transform_n.hpp
+// Description:     Word operation over any number of bit ranges, in a single
+//                  pass, for queries over many bitmaps
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TRANSFORM_N_HPP_INCLUDED
+#define _TRANSFORM_N_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_algorithm_details.hpp"
+#include "dispatch.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// --------------------------- TRANSFORM N: DETAILS ------------------------- //
+// Asks for the cache lines of [p, p + bytes) ahead of their use. Many input
+// streams are more than the hardware prefetchers follow.
+inline void _prefetch_read(const void* p, std::size_t bytes) noexcept {
+#if defined(__GNUC__)
+    for (std::size_t i = 0; i < bytes; i += 64) {
+        __builtin_prefetch(static_cast<const char*>(p) + i);
+    }
+#else
+    (void)p;
+    (void)bytes;
+#endif
+}
+
+// Whether op has the block form, which computes n positions at once
+template <class WordOperation, class T>
+using _has_block_operation = std::is_invocable<
+    WordOperation&, const T* const*, const std::size_t*, std::size_t, std::size_t, T*>;
+
+// dst[j] = op of the k words of the rows at position j, for j in [0, n).
+// Operations without a block form are called once per position, with the
+// words gathered into column.
+template <class T, class WordOperation>
+void _transform_n_block(
+        WordOperation& op, const T* const* rows, const std::size_t* offsets,
+        std::size_t k, std::size_t n, T* dst, T* column) {
+    if constexpr (_has_block_operation<WordOperation, T>::value) {
+        op(rows, offsets, k, n, dst);
+    } else {
+        for (std::size_t j = 0; j < n; ++j) {
+            for (std::size_t i = 0; i < k; ++i) {
+                column[i] = _funnel_word(rows[i][j], rows[i][j + 1], offsets[i]);
+            }
+            dst[j] = static_cast<T>(op(static_cast<const T*>(column), k));
+        }
+    }
+}
+
+// The block form of the reductions by a bitwise operation, whose neutral
+// word is identity
+template <class T, class BinaryOperation>
+void _transform_rows(
+        const T* const* rows, const std::size_t* offsets, std::size_t k,
+        std::size_t n, T* dst, T identity, BinaryOperation op) {
+    if (k == 0) {
+        std::fill(dst, dst + n, identity);
+        return;
+    }
+#ifdef BITLIB_DISPATCH
+    _simd_transform_rows<T>(rows, offsets, k, n, dst, op);
+#else
+    _transform_rows_words(rows, offsets, k, n, dst, op);
+#endif
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- TRANSFORM N: OPERATIONS ------------------------ //
+// The word operations of transform_n are called with the k words of a
+// position, op(words, k), and return the word of the result.
+//
+// They may also have a block form, op(rows, offsets, k, n, dst), which
+// computes the words of n positions at once. The words of input i start at
+// bit offsets[i] of rows[i], for example as (rows[i][j] >> offsets[i]) |
+// (rows[i][j + 1] << (digits - offsets[i])) when the offset is not zero,
+// and rows[i][n] is always readable. dst may be one of the rows, so a
+// position is read before it is written.
+
+// Bits set in all the inputs
+struct bit_and_all {
+    template <class T>
+    constexpr T operator()(const T* words, std::size_t k) const noexcept {
+        T result = static_cast<T>(-1);
+        for (std::size_t i = 0; i < k; ++i) {
+            result &= words[i];
+        }
+        return result;
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+        _transform_rows(rows, offsets, k, n, dst, static_cast<T>(-1), std::bit_and<T>());
+    }
+};
+
+// Bits set in any of the inputs
+struct bit_or_all {
+    template <class T>
+    constexpr T operator()(const T* words, std::size_t k) const noexcept {
+        T result = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            result |= words[i];
+        }
+        return result;
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+        _transform_rows(rows, offsets, k, n, dst, T(0), std::bit_or<T>());
+    }
+};
+
+// Bits set in an odd number of the inputs
+struct bit_xor_all {
+    template <class T>
+    constexpr T operator()(const T* words, std::size_t k) const noexcept {
+        T result = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            result ^= words[i];
+        }
+        return result;
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+        _transform_rows(rows, offsets, k, n, dst, T(0), std::bit_xor<T>());
+    }
+};
+
+// Bits set in at least threshold of the inputs
+struct bit_at_least {
+    constexpr explicit bit_at_least(std::size_t threshold) noexcept
+        : threshold(threshold) {}
+    template <class T>
+    T operator()(const T* words, std::size_t k) const {
+        // Each word gets a row of its own, followed by a readable word
+        std::vector<T> padded(2 * k);
+        std::vector<const T*> rows(k);
+        const std::vector<std::size_t> offsets(k, 0);
+        for (std::size_t i = 0; i < k; ++i) {
+            padded[2 * i] = words[i];
+            rows[i] = padded.data() + 2 * i;
+        }
+        T result;
+        (*this)(static_cast<const T* const*>(rows.data()), offsets.data(), k, 1, &result);
+        return result;
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+        if (threshold == 0 || threshold > k) {
+            std::fill(dst, dst + n, threshold == 0 ? static_cast<T>(-1) : T(0));
+            return;
+        }
+#ifdef BITLIB_DISPATCH
+        _simd_count_at_least<T>(rows, offsets, k, n, threshold, dst);
+#else
+        _count_at_least_words(rows, offsets, k, n, threshold, dst);
+#endif
+    }
+    std::size_t threshold;
+};
+
+// Bits set in more than half of the inputs
+struct bit_majority {
+    template <class T>
+    T operator()(const T* words, std::size_t k) const {
+        return bit_at_least(k / 2 + 1)(words, k);
+    }
+    template <class T>
+    void operator()(const T* const* rows, const std::size_t* offsets,
+            std::size_t k, std::size_t n, T* dst) const {
+        bit_at_least(k / 2 + 1)(rows, offsets, k, n, dst);
+    }
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------ TRANSFORM N ------------------------------- //
+// Writes op of the next total_bits_to_op bits of the inputs starting at
+// firsts to the range starting at d_first, and returns its end. firsts are
+// advanced past the bits read.
+template <class InputIt, class RandomAccessIt, class WordOperation>
+bit_iterator<RandomAccessIt> _transform_n(
+        std::vector<InputIt>& firsts,
+        typename bit_iterator<RandomAccessIt>::size_type total_bits_to_op,
+        bit_iterator<RandomAccessIt> d_first,
+        WordOperation& op) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    using size_type = typename bit_iterator<RandomAccessIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr size_type block = 1024 / sizeof(word_type);
+    // More streams than this are slower to prefetch than to leave to the
+    // hardware prefetchers
+    constexpr size_type prefetched_inputs = 4;
+
+    // Initialization
+    const size_type k = firsts.size();
+    if (total_bits_to_op == 0) return d_first;
+    size_type remaining_bits_to_op = total_bits_to_op;
+    std::vector<word_type> column(k);
+    auto it = d_first.base();
+
+    // Reads the next len bits of every input into column
+    auto gather = [&](size_type len) {
+        for (size_type i = 0; i < k; ++i) {
+            column[i] = get_word<word_type>(firsts[i], len);
+            advance(firsts[i], len);
+        }
+    };
+
+    // d_first is not aligned. Computes a partial word to align it
+    if (d_first.position() != 0) {
+        const size_type partial_bits_to_op = std::min<size_type>(
+                remaining_bits_to_op, digits - d_first.position());
+        gather(partial_bits_to_op);
+        const word_type result = static_cast<word_type>(
+                op(static_cast<const word_type*>(column.data()), k));
+        *it = _bitblend(
+                *it,
+                static_cast<word_type>(result << d_first.position()),
+                static_cast<word_type>(d_first.position()),
+                static_cast<word_type>(partial_bits_to_op));
+        remaining_bits_to_op -= partial_bits_to_op;
+        ++it;
+    }
+
+    // Whole words of the destination, a block at a time. Shifting the
+    // words of an input reads the word after each of them, which is part of
+    // the input for all the words but the last one, left to the loop below.
+    size_type words_to_op = remaining_bits_to_op > digits
+        ? (remaining_bits_to_op - 1) / digits
+        : 0;
+    std::vector<const word_type*> rows(k);
+    std::vector<std::size_t> offsets(k);
+    while (words_to_op > 0) {
+        const size_type n = std::min(block, words_to_op);
+        for (size_type i = 0; i < k; ++i) {
+            rows[i] = &*firsts[i].base();
+            offsets[i] = firsts[i].position();
+            if (i < prefetched_inputs) {
+                _prefetch_read(rows[i] + n, n * sizeof(word_type));
+            }
+            advance(firsts[i], n * digits);
+        }
+        _transform_n_block(op, rows.data(), offsets.data(), k, n, &*it, column.data());
+        it += n;
+        words_to_op -= n;
+        remaining_bits_to_op -= n * digits;
+    }
+    while (remaining_bits_to_op >= digits) {
+        gather(digits);
+        *it = static_cast<word_type>(op(static_cast<const word_type*>(column.data()), k));
+        ++it;
+        remaining_bits_to_op -= digits;
+    }
+
+    // Partial last word
+    if (remaining_bits_to_op > 0) {
+        gather(remaining_bits_to_op);
+        *it = _bitblend(
+                *it,
+                static_cast<word_type>(op(static_cast<const word_type*>(column.data()), k)),
+                static_cast<word_type>((static_cast<word_type>(1) << remaining_bits_to_op) - 1));
+    }
+    return d_first + total_bits_to_op;
+}
+
+// The beginnings of the inputs, which must all have the same size, and that
+// size
+template <class Inputs>
+auto _begin_inputs(const Inputs& inputs) {
+    using input_iterator = decltype(std::begin(*std::begin(inputs)));
+    std::vector<input_iterator> firsts;
+    for (const auto& input : inputs) {
+        firsts.push_back(std::begin(input));
+    }
+    assert(!firsts.empty());
+    const auto total_bits = distance(firsts[0], std::end(*std::begin(inputs)));
+    for (const auto& input : inputs) {
+        assert(distance(std::begin(input), std::end(input)) == total_bits);
+        (void)input;
+    }
+    return std::make_pair(std::move(firsts), total_bits);
+}
+
+// Writes op of the k ranges of inputs to the range starting at d_first, and
+// returns its end. inputs is a container of bit ranges of the same size,
+// such as bit spans, over contiguous words. The inputs are read once, a
+// block of words at a time: the next block of the first inputs is
+// prefetched, and the words of the inputs that do not start on a word
+// boundary are shifted into place as op reads them. d_first may be the
+// beginning of one of the inputs, but the output may not otherwise overlap
+// them.
+template <class Inputs, class RandomAccessIt, class WordOperation>
+bit_iterator<RandomAccessIt> transform_n(
+        const Inputs& inputs,
+        bit_iterator<RandomAccessIt> d_first,
+        WordOperation op) {
+    using word_type = std::remove_cv_t<typename bit_iterator<RandomAccessIt>::word_type>;
+    using input_iterator = decltype(std::begin(*std::begin(inputs)));
+    static_assert(std::is_same<
+            word_type,
+            std::remove_cv_t<typename input_iterator::word_type>
+        >::value, "transform_n combines ranges of the same word type");
+    auto [firsts, total_bits_to_op] = _begin_inputs(inputs);
+    return _transform_n(firsts, total_bits_to_op, d_first, op);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _TRANSFORM_N_HPP_INCLUDED
+// ========================================================================== //
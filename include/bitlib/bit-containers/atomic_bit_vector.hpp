@@ -0,0 +1,337 @@
+// ============================= ATOMIC BIT VECTOR ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        atomic_bit_vector.hpp
+// Description: Fixed-size bit vector with lock-free per-bit and per-word
+//              read-modify-write operations
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ATOMIC_BIT_VECTOR_HPP_INCLUDED
+#define _ATOMIC_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// ------------------------- ATOMIC WORD OPERATIONS ------------------------- //
+// std::atomic_ref is only available from C++20 onwards. Before that we fall
+// back on the GCC/Clang __atomic builtins, which operate on the same plain
+// words and use the same memory_order values.
+#if __cplusplus >= 202002L
+template <class WordType>
+inline WordType _atomic_load(
+        const WordType& word, std::memory_order order) noexcept {
+    return std::atomic_ref<WordType>(const_cast<WordType&>(word)).load(order);
+}
+
+template <class WordType>
+inline void _atomic_store(
+        WordType& word, WordType value, std::memory_order order) noexcept {
+    std::atomic_ref<WordType>(word).store(value, order);
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_or(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return std::atomic_ref<WordType>(word).fetch_or(mask, order);
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_and(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return std::atomic_ref<WordType>(word).fetch_and(mask, order);
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_xor(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return std::atomic_ref<WordType>(word).fetch_xor(mask, order);
+}
+
+template <class WordType>
+inline bool _atomic_compare_exchange(
+        WordType& word,
+        WordType& expected,
+        WordType desired,
+        std::memory_order order) noexcept {
+    return std::atomic_ref<WordType>(word).compare_exchange_weak(
+            expected, desired, order);
+}
+#else
+// Strongest ordering that is valid for the failure case of a CAS
+constexpr int _atomic_failure_order(std::memory_order order) noexcept {
+    return order == std::memory_order_acq_rel
+        ? static_cast<int>(std::memory_order_acquire)
+        : order == std::memory_order_release
+            ? static_cast<int>(std::memory_order_relaxed)
+            : static_cast<int>(order);
+}
+
+template <class WordType>
+inline WordType _atomic_load(
+        const WordType& word, std::memory_order order) noexcept {
+    return __atomic_load_n(&word, static_cast<int>(order));
+}
+
+template <class WordType>
+inline void _atomic_store(
+        WordType& word, WordType value, std::memory_order order) noexcept {
+    __atomic_store_n(&word, value, static_cast<int>(order));
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_or(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return __atomic_fetch_or(&word, mask, static_cast<int>(order));
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_and(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return __atomic_fetch_and(&word, mask, static_cast<int>(order));
+}
+
+template <class WordType>
+inline WordType _atomic_fetch_xor(
+        WordType& word, WordType mask, std::memory_order order) noexcept {
+    return __atomic_fetch_xor(&word, mask, static_cast<int>(order));
+}
+
+template <class WordType>
+inline bool _atomic_compare_exchange(
+        WordType& word,
+        WordType& expected,
+        WordType desired,
+        std::memory_order order) noexcept {
+    return __atomic_compare_exchange_n(
+            &word, &expected, desired, true,
+            static_cast<int>(order), _atomic_failure_order(order));
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
+/* ************************* ATOMIC BIT REFERENCE *************************** */
+//! A reference to a single bit whose modifications are atomic RMW operations
+template <class WordType>
+class atomic_bit_reference {
+    public:
+        using word_type = WordType;
+        using size_type = std::size_t;
+
+        constexpr atomic_bit_reference(word_type& ref, size_type pos) noexcept
+            : _ptr(&ref), _mask(static_cast<word_type>(1) << pos) {}
+
+        // Loads
+        bool load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+            return _atomic_load(*_ptr, order) & _mask;
+        }
+        explicit operator bool() const noexcept {return load();}
+
+        // Stores
+        void store(bit_value val, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            val == bit1 ? (void) fetch_set(order) : (void) fetch_reset(order);
+        }
+        atomic_bit_reference& operator=(bit_value val) noexcept {
+            store(val);
+            return *this;
+        }
+
+        // Read-modify-write operations. Each returns the previous bit value.
+        bool test_and_set(std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return fetch_set(order);
+        }
+        bool fetch_set(std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_or(*_ptr, _mask, order) & _mask;
+        }
+        bool fetch_reset(std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_and(*_ptr, static_cast<word_type>(~_mask), order) & _mask;
+        }
+        bool fetch_flip(std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_xor(*_ptr, _mask, order) & _mask;
+        }
+
+        // Underlying details
+        constexpr word_type* address() const noexcept {return _ptr;}
+        constexpr size_type position() const noexcept {return _tzcnt(_mask);}
+        constexpr word_type mask() const noexcept {return _mask;}
+
+    private:
+        word_type* _ptr;
+        word_type _mask;
+};
+/* ************************************************************************** */
+
+
+
+/* ************************** ATOMIC BIT VECTOR ***************************** */
+//! A fixed-size bit-vector which can be modified concurrently by many threads.
+//
+// Every modifying member is a single atomic read-modify-write on the word
+// holding the bit(s). The const iterators and data() read the words with
+// plain loads, so handing them to the algorithms (bit::count, bit::find, ...)
+// is only valid while no writer is running, e.g. once the writers are joined.
+// count() is the bulk reader that may run alongside writers.
+template<class WordType, class Allocator = std::allocator<WordType>>
+class atomic_bit_vector {
+    private:
+        static constexpr size_t digits = binary_digits<WordType>::value;
+        static_assert(std::is_unsigned<WordType>::value, "");
+        std::vector<WordType, Allocator> word_vector;
+        size_t length_ = 0;
+
+        // @brief Get the number of words needed to represet num_bits bits
+        static constexpr size_t word_count(size_t num_bits) {
+            return ((num_bits + digits - 1) / digits);
+        }
+
+    public:
+        /*
+         * Types and typedefs
+         */
+        using value_type = bit_value;
+        using base_type = WordType;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = atomic_bit_reference<WordType>;
+        using const_iterator = bit_iterator<const WordType*>;
+
+
+        /*
+         * Constructors
+         */
+        atomic_bit_vector() = default;
+        explicit atomic_bit_vector(
+                size_type count,
+                value_type bit_val=bit0,
+                const Allocator& alloc=Allocator())
+            : word_vector(word_count(count), static_cast<WordType>(bit_val == bit1 ? -1 : 0), alloc),
+              length_(count) {
+            // Keep the padding bits of the last word cleared
+            if (bit_val == bit1 && count % digits) {
+                word_vector.back() &= static_cast<WordType>(~(static_cast<WordType>(-1) << (count % digits)));
+            }
+        }
+        // Concurrent modification makes copies meaningless
+        atomic_bit_vector(const atomic_bit_vector&) = delete;
+        atomic_bit_vector& operator=(const atomic_bit_vector&) = delete;
+        atomic_bit_vector(atomic_bit_vector&&) noexcept = default;
+        atomic_bit_vector& operator=(atomic_bit_vector&&) noexcept = default;
+
+
+        /*
+         * Per-bit access
+         */
+        reference operator[](size_type pos) noexcept {
+            return reference(word_vector[pos / digits], pos % digits);
+        }
+        bool test(size_type pos, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+            return (_atomic_load(word_vector[pos / digits], order) >> (pos % digits)) & 1;
+        }
+        bool test_and_set(size_type pos, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return (*this)[pos].test_and_set(order);
+        }
+        bool fetch_reset(size_type pos, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return (*this)[pos].fetch_reset(order);
+        }
+        bool fetch_flip(size_type pos, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return (*this)[pos].fetch_flip(order);
+        }
+
+
+        /*
+         * Per-word access. Word indices are in units of WordType.
+         */
+        WordType load_word(size_type idx, std::memory_order order = std::memory_order_seq_cst) const noexcept {
+            return _atomic_load(word_vector[idx], order);
+        }
+        void store_word(size_type idx, WordType value, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            _atomic_store(word_vector[idx], value, order);
+        }
+        // Merges a mask into a word, returning the previous word
+        WordType fetch_or_word(size_type idx, WordType mask, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_or(word_vector[idx], mask, order);
+        }
+        WordType fetch_and_word(size_type idx, WordType mask, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_and(word_vector[idx], mask, order);
+        }
+        WordType fetch_xor_word(size_type idx, WordType mask, std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_fetch_xor(word_vector[idx], mask, order);
+        }
+        // Weak CAS: on failure expected is updated with the current word
+        bool compare_exchange_word(
+                size_type idx,
+                WordType& expected,
+                WordType desired,
+                std::memory_order order = std::memory_order_seq_cst) noexcept {
+            return _atomic_compare_exchange(word_vector[idx], expected, desired, order);
+        }
+
+
+        /*
+         * Bulk readers. count() loads each word atomically and may race with
+         * writers, observing their updates word by word. The iterators and
+         * data() use plain loads and require that no writer is running.
+         */
+        size_type count(std::memory_order order = std::memory_order_relaxed) const noexcept {
+            size_type ones = 0;
+            const size_type full_words = length_ / digits;
+            for (size_type i = 0; i < full_words; ++i) {
+                ones += _popcnt(_atomic_load(word_vector[i], order));
+            }
+            if (length_ % digits) {
+                const WordType tail = static_cast<WordType>(
+                        ~(static_cast<WordType>(-1) << (length_ % digits)));
+                ones += _popcnt(static_cast<WordType>(
+                        _atomic_load(word_vector[full_words], order) & tail));
+            }
+            return ones;
+        }
+        const_iterator begin() const noexcept {return const_iterator(word_vector.data());}
+        const_iterator end() const noexcept {return begin() + length_;}
+        const_iterator cbegin() const noexcept {return begin();}
+        const_iterator cend() const noexcept {return end();}
+        const WordType* data() const noexcept {return word_vector.data();}
+
+
+        /*
+         * Capacity
+         */
+        bool empty() const noexcept {return length_ == 0;}
+        size_type size() const noexcept {return length_;}
+        size_type word_size() const noexcept {return word_vector.size();}
+
+
+        /*
+         * Non-concurrent modifiers. These must not race with any other access.
+         */
+        void clear() noexcept {
+            std::fill(word_vector.begin(), word_vector.end(), static_cast<WordType>(0));
+        }
+};
+/* ************************************************************************** */
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _ATOMIC_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
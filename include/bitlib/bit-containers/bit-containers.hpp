@@ -8,5 +8,17 @@
 #define _BIT_CONTAINERS_HPP_INCLUDED
 // ============================== PREAMBLE ================================== //
 #include "bit_vector.hpp"
+#include "bit_expression.hpp"
+#include "bit_array.hpp"
+#include "small_bit_vector.hpp"
+#include "bit_span.hpp"
+#include "mmap_bit_vector.hpp"
+#include "serialization.hpp"
+#include "bit_stream.hpp"
+#include "universal_codes.hpp"
+#include "dynamic_bit_vector.hpp"
+#include "atomic_bit_vector.hpp"
+#include "id_allocator.hpp"
+#include "extent_allocator.hpp"
 // ========================================================================== //
 #endif
@@ -0,0 +1,380 @@
+// ================================ BIT ARRAY =============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_array.hpp
+// Description: Fixed-size bit container with inline storage
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_ARRAY_HPP_INCLUDED
+#define _BIT_ARRAY_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************* BIT ARRAY ******************************** */
+//! A fixed-size sequence of N bits, similar to std::bitset, stored inline.
+//
+// Every member function is constexpr. The whole-array operations are unrolled
+// over the words at compile time, and the bits past N in the last word are
+// always kept at zero, so that they never have to be masked out on reads.
+// The iterators are bit_iterators over the words, so that all of the bit::
+// algorithms apply to a bit_array as well.
+template<std::size_t N, class WordType = std::uint64_t>
+class bit_array {
+    private:
+        static constexpr std::size_t digits = binary_digits<WordType>::value;
+        static constexpr std::size_t num_words = (N + digits - 1) / digits;
+        static constexpr WordType all_ones = static_cast<WordType>(-1);
+        // Mask of the bits of the last word which belong to the array
+        static constexpr WordType last_word_mask = N % digits == 0
+            ? all_ones
+            : static_cast<WordType>((static_cast<WordType>(1) << (N % digits)) - 1);
+
+        std::array<WordType, num_words> words_{};
+
+        // Calls f(0), ..., f(num_words - 1), unrolled
+        template <class F, std::size_t... I>
+        static constexpr void _unroll(F&& f, std::index_sequence<I...>) {
+            (f(I), ...);
+        }
+        template <class F>
+        static constexpr void _for_each_word(F&& f) {
+            _unroll(f, std::make_index_sequence<num_words>());
+        }
+        // Whether pred(i) holds for every word, stopping at the first failure
+        template <class Predicate, std::size_t... I>
+        static constexpr bool _all_of(Predicate&& pred, std::index_sequence<I...>) {
+            return (pred(I) && ...);
+        }
+        constexpr void _clear_padding() noexcept {
+            if constexpr (num_words != 0) {
+                words_[num_words - 1] &= last_word_mask;
+            }
+        }
+
+    public:
+        /*
+         * Types and typedefs
+         */
+        using value_type = bit_value;
+        using base_type = WordType;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = bit_reference<WordType>;
+        using const_reference = bit_value;
+        using pointer = bit_pointer<WordType>;
+        using iterator = bit_iterator<WordType*>;
+        using const_iterator = bit_iterator<const WordType*>;
+
+
+        /*
+         * Constructors
+         */
+        constexpr bit_array() noexcept = default;
+        constexpr explicit bit_array(bit_value bv) noexcept;
+        constexpr bit_array(std::initializer_list<WordType> init);
+        constexpr explicit bit_array(std::string_view s);
+
+
+        /*
+         * Element Access
+         */
+        constexpr reference operator[](size_type pos);
+        constexpr const_reference operator[](size_type pos) const;
+        constexpr reference at(size_type pos);
+        constexpr const_reference at(size_type pos) const;
+        constexpr bool test(size_type pos) const;
+        constexpr reference front();
+        constexpr const_reference front() const;
+        constexpr reference back();
+        constexpr const_reference back() const;
+        constexpr WordType* data() noexcept {return words_.data();}
+        constexpr const WordType* data() const noexcept {return words_.data();}
+
+
+        /*
+         * Iterators
+         */
+        constexpr iterator begin() noexcept {return iterator(data());}
+        constexpr iterator end() noexcept {return begin() + N;}
+        constexpr const_iterator begin() const noexcept {return const_iterator(data());}
+        constexpr const_iterator end() const noexcept {return begin() + N;}
+        constexpr const_iterator cbegin() const noexcept {return begin();}
+        constexpr const_iterator cend() const noexcept {return end();}
+
+
+        /*
+         * Capacity
+         */
+        constexpr bool empty() const noexcept {return N == 0;}
+        constexpr size_type size() const noexcept {return N;}
+        constexpr size_type max_size() const noexcept {return N;}
+
+
+        /*
+         * Operations, unrolled over the words
+         */
+        constexpr void fill(bit_value bv) noexcept;
+        constexpr bit_array& set() noexcept;
+        constexpr bit_array& set(size_type pos, bit_value bv = bit1);
+        constexpr bit_array& reset() noexcept;
+        constexpr bit_array& reset(size_type pos);
+        constexpr bit_array& flip() noexcept;
+        constexpr bit_array& flip(size_type pos);
+        constexpr size_type count() const noexcept;
+        constexpr bool all() const noexcept;
+        constexpr bool any() const noexcept;
+        constexpr bool none() const noexcept;
+        constexpr bit_array& operator&=(const bit_array& other) noexcept;
+        constexpr bit_array& operator|=(const bit_array& other) noexcept;
+        constexpr bit_array& operator^=(const bit_array& other) noexcept;
+        constexpr bit_array operator~() const noexcept;
+
+        friend constexpr bit_array operator&(bit_array lhs, const bit_array& rhs) noexcept {
+            return lhs &= rhs;
+        }
+        friend constexpr bit_array operator|(bit_array lhs, const bit_array& rhs) noexcept {
+            return lhs |= rhs;
+        }
+        friend constexpr bit_array operator^(bit_array lhs, const bit_array& rhs) noexcept {
+            return lhs ^= rhs;
+        }
+        friend constexpr bool operator==(const bit_array& lhs, const bit_array& rhs) noexcept {
+            return _all_of([&](std::size_t i) {return lhs.words_[i] == rhs.words_[i];},
+                    std::make_index_sequence<num_words>());
+        }
+        friend constexpr bool operator!=(const bit_array& lhs, const bit_array& rhs) noexcept {
+            return !(lhs == rhs);
+        }
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT ARRAY: LIFECYCLE --------------------------- //
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>::bit_array(bit_value bv) noexcept {
+    fill(bv);
+}
+
+// Words are given from the least significant one on; missing words are zero
+// and the bits past N are dropped
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>::bit_array(std::initializer_list<WordType> init) {
+    size_type i = 0;
+    for (WordType word : init) {
+        if (i == num_words) {
+            break;
+        }
+        words_[i++] = word;
+    }
+    _clear_padding();
+}
+
+// Skips all characters that are not 0/1, as bit_vector does. Bits past N
+// are ignored.
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>::bit_array(std::string_view s) {
+    size_type i = 0;
+    for (char c : s) {
+        if (i == N) {
+            break;
+        }
+        if (c == '0' || c == '1') {
+            set(i++, c == '1' ? bit1 : bit0);
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT ARRAY: ACCESS ----------------------------- //
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::reference
+bit_array<N, WordType>::operator[](size_type pos) {
+    return reference(words_[pos / digits], pos % digits);
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::const_reference
+bit_array<N, WordType>::operator[](size_type pos) const {
+    return bit_value(words_[pos / digits], pos % digits);
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::reference
+bit_array<N, WordType>::at(size_type pos) {
+    if (pos < N) {
+        return (*this)[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::const_reference
+bit_array<N, WordType>::at(size_type pos) const {
+    if (pos < N) {
+        return (*this)[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template<std::size_t N, class WordType>
+constexpr bool bit_array<N, WordType>::test(size_type pos) const {
+    return at(pos) == bit1;
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::reference
+bit_array<N, WordType>::front() {
+    return (*this)[0];
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::const_reference
+bit_array<N, WordType>::front() const {
+    return (*this)[0];
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::reference
+bit_array<N, WordType>::back() {
+    return (*this)[N - 1];
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::const_reference
+bit_array<N, WordType>::back() const {
+    return (*this)[N - 1];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT ARRAY: OPERATIONS -------------------------- //
+template<std::size_t N, class WordType>
+constexpr void bit_array<N, WordType>::fill(bit_value bv) noexcept {
+    const WordType word = bv == bit1 ? all_ones : WordType(0);
+    _for_each_word([&](std::size_t i) {words_[i] = word;});
+    _clear_padding();
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::set() noexcept {
+    fill(bit1);
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::set(size_type pos, bit_value bv) {
+    at(pos) = bv;
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::reset() noexcept {
+    fill(bit0);
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::reset(size_type pos) {
+    return set(pos, bit0);
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::flip() noexcept {
+    _for_each_word([&](std::size_t i) {words_[i] = static_cast<WordType>(~words_[i]);});
+    _clear_padding();
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>& bit_array<N, WordType>::flip(size_type pos) {
+    at(pos).flip();
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr typename bit_array<N, WordType>::size_type
+bit_array<N, WordType>::count() const noexcept {
+    size_type result = 0;
+    _for_each_word([&](std::size_t i) {result += _popcnt(words_[i]);});
+    return result;
+}
+
+template<std::size_t N, class WordType>
+constexpr bool bit_array<N, WordType>::all() const noexcept {
+    return _all_of([&](std::size_t i) {
+                return words_[i] == (i + 1 == num_words ? last_word_mask : all_ones);
+            },
+            std::make_index_sequence<num_words>());
+}
+
+template<std::size_t N, class WordType>
+constexpr bool bit_array<N, WordType>::any() const noexcept {
+    return !none();
+}
+
+template<std::size_t N, class WordType>
+constexpr bool bit_array<N, WordType>::none() const noexcept {
+    return _all_of([&](std::size_t i) {return words_[i] == 0;},
+            std::make_index_sequence<num_words>());
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>&
+bit_array<N, WordType>::operator&=(const bit_array& other) noexcept {
+    _for_each_word([&](std::size_t i) {words_[i] &= other.words_[i];});
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>&
+bit_array<N, WordType>::operator|=(const bit_array& other) noexcept {
+    _for_each_word([&](std::size_t i) {words_[i] |= other.words_[i];});
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType>&
+bit_array<N, WordType>::operator^=(const bit_array& other) noexcept {
+    _for_each_word([&](std::size_t i) {words_[i] ^= other.words_[i];});
+    return *this;
+}
+
+template<std::size_t N, class WordType>
+constexpr bit_array<N, WordType> bit_array<N, WordType>::operator~() const noexcept {
+    bit_array result(*this);
+    return result.flip();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_ARRAY_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,254 @@
+// ============================= BIT EXPRESSION ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_expression.hpp
+// Description: Lazy bitwise expressions over the words of bit vectors
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_EXPRESSION_HPP_INCLUDED
+#define _BIT_EXPRESSION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/transform_assign.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ***************************** BIT EXPRESSION ***************************** */
+//! Base of the lazy bitwise expressions. An expression only refers to its
+//! operands and computes each of its words on demand, so a whole tree such
+//! as (a & b) | ~c is evaluated in a single pass over the words when it is
+//! assigned to a bit_vector, counted or tested, without any intermediate
+//! vector. Expressions refer to the words of their operands, and are meant
+//! to be consumed in the statement that builds them.
+//!
+//! An expression has a word_type, a size() in bits and a word(i) member.
+//! The bits of its last word past size() are unspecified, and are cleared
+//! wherever the words are consumed.
+template <class Expression>
+class bit_expression {
+    public:
+    constexpr const Expression& derived() const noexcept;
+    constexpr std::size_t count() const noexcept;
+    constexpr bool any() const noexcept;
+    constexpr bool all() const noexcept;
+    constexpr bool none() const noexcept;
+};
+
+// The words of a bit vector, as the leaves of an expression
+template <class WordType>
+class bit_words_expression : public bit_expression<bit_words_expression<WordType>> {
+    public:
+    using word_type = WordType;
+
+    constexpr bit_words_expression(const WordType* words, std::size_t size) noexcept
+        : words_(words), size_(size) {}
+    constexpr std::size_t size() const noexcept {return size_;}
+    constexpr WordType word(std::size_t i) const noexcept {return words_[i];}
+
+    private:
+    const WordType* words_;
+    std::size_t size_;
+};
+
+// Operation applied word by word to two expressions of the same size
+template <class Operation, class Left, class Right>
+class bit_binary_expression : public bit_expression<bit_binary_expression<Operation, Left, Right>> {
+    static_assert(std::is_same<typename Left::word_type, typename Right::word_type>::value,
+            "bit expressions combine operands of the same word type");
+
+    public:
+    using word_type = typename Left::word_type;
+
+    constexpr bit_binary_expression(const Left& lhs, const Right& rhs) noexcept
+        : lhs_(lhs), rhs_(rhs) {
+        assert(lhs.size() == rhs.size());
+    }
+    constexpr std::size_t size() const noexcept {return lhs_.size();}
+    constexpr word_type word(std::size_t i) const noexcept {
+        return static_cast<word_type>(Operation()(lhs_.word(i), rhs_.word(i)));
+    }
+
+    private:
+    Left lhs_;
+    Right rhs_;
+};
+
+// Complement of an expression
+template <class Operand>
+class bit_not_expression : public bit_expression<bit_not_expression<Operand>> {
+    public:
+    using word_type = typename Operand::word_type;
+
+    constexpr explicit bit_not_expression(const Operand& operand) noexcept
+        : operand_(operand) {}
+    constexpr std::size_t size() const noexcept {return operand_.size();}
+    constexpr word_type word(std::size_t i) const noexcept {
+        return static_cast<word_type>(~operand_.word(i));
+    }
+
+    private:
+    Operand operand_;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT EXPRESSION: DETAILS ------------------------ //
+// An expression is its own operand. Containers take part in expressions
+// through an overload of _as_bit_expression that returns a
+// bit_words_expression onto their words.
+template <class Expression>
+constexpr const Expression& _as_bit_expression(const bit_expression<Expression>& expr) noexcept {
+    return expr.derived();
+}
+
+template <class T>
+using _bit_operand_t = std::decay_t<decltype(_as_bit_expression(std::declval<const T&>()))>;
+
+// Mask of the bits of the last word of an expression that are within its
+// size, or all ones when the size is a multiple of the word size
+template <class WordType>
+constexpr WordType _last_word_mask(std::size_t size) noexcept {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    const std::size_t tail = size % digits;
+    return tail ? static_cast<WordType>((WordType(1) << tail) - 1) : static_cast<WordType>(-1);
+}
+
+// Writes the words of an expression to out, with the bits of the last word
+// past the end cleared. out may be the storage of one of the operands.
+template <class Expression>
+constexpr void _assign_bit_expression(typename Expression::word_type* out, const Expression& expr) noexcept {
+    using word_type = typename Expression::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const std::size_t num_words = (expr.size() + digits - 1) / digits;
+    for (std::size_t i = 0; i < num_words; ++i) {
+        out[i] = expr.word(i);
+    }
+    if (num_words != 0) {
+        out[num_words - 1] &= _last_word_mask<word_type>(expr.size());
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ BIT EXPRESSION: REDUCTIONS ---------------------- //
+template <class Expression>
+constexpr const Expression& bit_expression<Expression>::derived() const noexcept {
+    return static_cast<const Expression&>(*this);
+}
+
+// Number of ones, in one pass over the words
+template <class Expression>
+constexpr std::size_t bit_expression<Expression>::count() const noexcept {
+    using word_type = typename Expression::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const Expression& expr = derived();
+    const std::size_t full_words = expr.size() / digits;
+    std::size_t ones = 0;
+    for (std::size_t i = 0; i < full_words; ++i) {
+        ones += _popcnt(expr.word(i));
+    }
+    if (expr.size() % digits != 0) {
+        ones += _popcnt(static_cast<word_type>(
+                expr.word(full_words) & _last_word_mask<word_type>(expr.size())));
+    }
+    return ones;
+}
+
+// Whether any bit is set, stopping at the first non zero word
+template <class Expression>
+constexpr bool bit_expression<Expression>::any() const noexcept {
+    using word_type = typename Expression::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const Expression& expr = derived();
+    const std::size_t full_words = expr.size() / digits;
+    for (std::size_t i = 0; i < full_words; ++i) {
+        if (expr.word(i) != 0) {
+            return true;
+        }
+    }
+    return expr.size() % digits != 0
+        && (expr.word(full_words) & _last_word_mask<word_type>(expr.size())) != 0;
+}
+
+// Whether every bit is set, stopping at the first word with a zero
+template <class Expression>
+constexpr bool bit_expression<Expression>::all() const noexcept {
+    using word_type = typename Expression::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    const Expression& expr = derived();
+    const std::size_t full_words = expr.size() / digits;
+    for (std::size_t i = 0; i < full_words; ++i) {
+        if (expr.word(i) != static_cast<word_type>(-1)) {
+            return false;
+        }
+    }
+    const word_type mask = _last_word_mask<word_type>(expr.size());
+    return expr.size() % digits == 0 || (expr.word(full_words) & mask) == mask;
+}
+
+template <class Expression>
+constexpr bool bit_expression<Expression>::none() const noexcept {
+    return !any();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ BIT EXPRESSION: OPERATORS ----------------------- //
+// Operands are expressions, or containers that provide _as_bit_expression.
+// The operands of a binary operator must have the same size.
+template <class Left, class Right>
+constexpr bit_binary_expression<std::bit_and<>, _bit_operand_t<Left>, _bit_operand_t<Right>>
+operator&(const Left& lhs, const Right& rhs) noexcept {
+    return {_as_bit_expression(lhs), _as_bit_expression(rhs)};
+}
+
+template <class Left, class Right>
+constexpr bit_binary_expression<std::bit_or<>, _bit_operand_t<Left>, _bit_operand_t<Right>>
+operator|(const Left& lhs, const Right& rhs) noexcept {
+    return {_as_bit_expression(lhs), _as_bit_expression(rhs)};
+}
+
+template <class Left, class Right>
+constexpr bit_binary_expression<std::bit_xor<>, _bit_operand_t<Left>, _bit_operand_t<Right>>
+operator^(const Left& lhs, const Right& rhs) noexcept {
+    return {_as_bit_expression(lhs), _as_bit_expression(rhs)};
+}
+
+// Set difference, the bits of lhs that are not in rhs
+template <class Left, class Right>
+constexpr bit_binary_expression<bit_andnot<>, _bit_operand_t<Left>, _bit_operand_t<Right>>
+operator-(const Left& lhs, const Right& rhs) noexcept {
+    return {_as_bit_expression(lhs), _as_bit_expression(rhs)};
+}
+
+template <class Operand>
+constexpr bit_not_expression<_bit_operand_t<Operand>>
+operator~(const Operand& operand) noexcept {
+    return bit_not_expression<_bit_operand_t<Operand>>(_as_bit_expression(operand));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_EXPRESSION_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,369 @@
+// ================================ BIT SPAN ================================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_span.hpp
+// Description: Non-owning view over a range of bits in external words
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_SPAN_HPP_INCLUDED
+#define _BIT_SPAN_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+// Some algorithm headers include bitlib.hpp, so bit_algorithm.hpp may not be
+// complete yet when this header is reached
+#include "bitlib/bit-algorithms/count.hpp"
+#include "bitlib/bit-algorithms/fill.hpp"
+#include "bitlib/bit-algorithms/transform.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************** BIT SPAN ******************************** */
+inline constexpr std::size_t dynamic_extent = std::numeric_limits<std::size_t>::max();
+
+// Holds the length of a span, which takes no space when it is known at
+// compile time
+template <std::size_t Extent>
+struct _bit_span_extent {
+    constexpr _bit_span_extent() noexcept = default;
+    constexpr explicit _bit_span_extent([[maybe_unused]] std::size_t size) noexcept {
+        assert(size == Extent);
+    }
+    constexpr std::size_t size() const noexcept {return Extent;}
+};
+
+template <>
+struct _bit_span_extent<dynamic_extent> {
+    constexpr _bit_span_extent() noexcept = default;
+    constexpr explicit _bit_span_extent(std::size_t size) noexcept : size_(size) {}
+    constexpr std::size_t size() const noexcept {return size_;}
+    std::size_t size_ = 0;
+};
+
+//! A view of Extent bits (or a length given at run time) starting at a bit
+//! offset into words owned by someone else, like std::span for bits. It
+//! never allocates: subviews share the words, and the operations run the bit
+//! algorithms on them in place. WordType may be const for a read-only view.
+template <class WordType, std::size_t Extent = dynamic_extent>
+class bit_span : private _bit_span_extent<Extent> {
+    private:
+        using extent_base = _bit_span_extent<Extent>;
+        using mutable_word_type = std::remove_const_t<WordType>;
+        static constexpr std::size_t digits = binary_digits<mutable_word_type>::value;
+
+        // words_ points to the word holding the first bit, and offset_ is
+        // the position of that bit in it, always below digits
+        WordType* words_ = nullptr;
+        std::size_t offset_ = 0;
+
+        template <class, std::size_t>
+        friend class bit_span;
+
+        // The algorithms need the same iterator type on every range, so the
+        // operand of the compound operators is read through a mutable view
+        template <class OtherWord, std::size_t OtherExtent>
+        static constexpr bit_iterator<mutable_word_type*> _mutable_begin(
+                const bit_span<OtherWord, OtherExtent>& other) noexcept {
+            return bit_iterator<mutable_word_type*>(
+                    const_cast<mutable_word_type*>(other.words_), other.offset_);
+        }
+
+    public:
+        /*
+         * Types and typedefs
+         */
+        using element_type = bit_value;
+        using value_type = bit_value;
+        using word_type = WordType;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator = bit_iterator<WordType*>;
+        using reference = typename iterator::reference;
+        using pointer = typename iterator::pointer;
+        static constexpr size_type extent = Extent;
+
+
+        /*
+         * Constructors
+         */
+        template <std::size_t E = Extent,
+                  class = std::enable_if_t<E == dynamic_extent || E == 0>>
+        constexpr bit_span() noexcept {}
+        constexpr bit_span(WordType* words, size_type bit_length) noexcept;
+        constexpr bit_span(WordType* words, size_type bit_offset, size_type bit_length) noexcept;
+        constexpr bit_span(iterator first, size_type bit_length) noexcept;
+        constexpr bit_span(iterator first, iterator last) noexcept;
+        // From a span over the same words, adding const or dropping the
+        // static extent
+        template <class OtherWord, std::size_t OtherExtent,
+                  class = std::enable_if_t<
+                      std::is_convertible_v<OtherWord(*)[], WordType(*)[]>
+                      && (Extent == dynamic_extent || Extent == OtherExtent)>>
+        constexpr bit_span(const bit_span<OtherWord, OtherExtent>& other) noexcept;
+        constexpr bit_span(const bit_span& other) noexcept = default;
+        constexpr bit_span& operator=(const bit_span& other) noexcept = default;
+
+
+        /*
+         * Element Access
+         */
+        constexpr reference operator[](size_type pos) const;
+        constexpr reference front() const;
+        constexpr reference back() const;
+        // Word holding the first bit, and position of the first bit in it
+        constexpr WordType* data() const noexcept {return words_;}
+        constexpr size_type offset() const noexcept {return offset_;}
+
+
+        /*
+         * Iterators
+         */
+        constexpr iterator begin() const noexcept {return iterator(words_, offset_);}
+        constexpr iterator end() const noexcept {return begin() + size();}
+
+
+        /*
+         * Observers
+         */
+        constexpr size_type size() const noexcept {return extent_base::size();}
+        constexpr bool empty() const noexcept {return size() == 0;}
+
+
+        /*
+         * Subviews
+         */
+        template <size_type Count>
+        constexpr bit_span<WordType, Count> first() const;
+        constexpr bit_span<WordType, dynamic_extent> first(size_type count) const;
+        template <size_type Count>
+        constexpr bit_span<WordType, Count> last() const;
+        constexpr bit_span<WordType, dynamic_extent> last(size_type count) const;
+        template <size_type Offset, size_type Count = dynamic_extent>
+        constexpr auto subspan() const;
+        constexpr bit_span<WordType, dynamic_extent> subspan(
+                size_type offset,
+                size_type count = dynamic_extent) const;
+
+
+        /*
+         * Operations, on the viewed bits in place
+         */
+        constexpr size_type count() const;
+        constexpr const bit_span& fill(bit_value bv) const;
+        constexpr const bit_span& flip() const;
+        // The operand must have the same size
+        template <class OtherWord, std::size_t OtherExtent>
+        constexpr const bit_span& operator&=(const bit_span<OtherWord, OtherExtent>& other) const;
+        template <class OtherWord, std::size_t OtherExtent>
+        constexpr const bit_span& operator|=(const bit_span<OtherWord, OtherExtent>& other) const;
+        template <class OtherWord, std::size_t OtherExtent>
+        constexpr const bit_span& operator^=(const bit_span<OtherWord, OtherExtent>& other) const;
+};
+
+// Deduction guides
+template <class WordType>
+bit_span(WordType*, std::size_t) -> bit_span<WordType>;
+template <class WordType>
+bit_span(WordType*, std::size_t, std::size_t) -> bit_span<WordType>;
+template <class WordType>
+bit_span(bit_iterator<WordType*>, std::size_t) -> bit_span<WordType>;
+template <class WordType>
+bit_span(bit_iterator<WordType*>, bit_iterator<WordType*>) -> bit_span<WordType>;
+/* ************************************************************************** */
+
+
+
+// -------------------------- BIT SPAN: LIFECYCLE --------------------------- //
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, Extent>::bit_span(
+        WordType* words,
+        size_type bit_length) noexcept
+    : bit_span(words, 0, bit_length) {}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, Extent>::bit_span(
+        WordType* words,
+        size_type bit_offset,
+        size_type bit_length) noexcept
+    : extent_base(bit_length),
+      words_(words + bit_offset / digits),
+      offset_(bit_offset % digits) {}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, Extent>::bit_span(
+        iterator first,
+        size_type bit_length) noexcept
+    : bit_span(first.base(), first.position(), bit_length) {}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, Extent>::bit_span(
+        iterator first,
+        iterator last) noexcept
+    : bit_span(first.base(), first.position(), distance(first, last)) {}
+
+template <class WordType, std::size_t Extent>
+template <class OtherWord, std::size_t OtherExtent, class>
+constexpr bit_span<WordType, Extent>::bit_span(
+        const bit_span<OtherWord, OtherExtent>& other) noexcept
+    : extent_base(other.size()),
+      words_(other.words_),
+      offset_(other.offset_) {}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- BIT SPAN: ACCESS ----------------------------- //
+template <class WordType, std::size_t Extent>
+constexpr typename bit_span<WordType, Extent>::reference
+bit_span<WordType, Extent>::operator[](size_type pos) const {
+    return begin()[pos];
+}
+
+template <class WordType, std::size_t Extent>
+constexpr typename bit_span<WordType, Extent>::reference
+bit_span<WordType, Extent>::front() const {
+    return begin()[0];
+}
+
+template <class WordType, std::size_t Extent>
+constexpr typename bit_span<WordType, Extent>::reference
+bit_span<WordType, Extent>::back() const {
+    return begin()[size() - 1];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT SPAN: SUBVIEWS ---------------------------- //
+template <class WordType, std::size_t Extent>
+template <std::size_t Count>
+constexpr bit_span<WordType, Count> bit_span<WordType, Extent>::first() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent);
+    assert(Count <= size());
+    return bit_span<WordType, Count>(begin(), Count);
+}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, dynamic_extent>
+bit_span<WordType, Extent>::first(size_type count) const {
+    assert(count <= size());
+    return bit_span<WordType, dynamic_extent>(begin(), count);
+}
+
+template <class WordType, std::size_t Extent>
+template <std::size_t Count>
+constexpr bit_span<WordType, Count> bit_span<WordType, Extent>::last() const {
+    static_assert(Extent == dynamic_extent || Count <= Extent);
+    assert(Count <= size());
+    return bit_span<WordType, Count>(end() - Count, Count);
+}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, dynamic_extent>
+bit_span<WordType, Extent>::last(size_type count) const {
+    assert(count <= size());
+    return bit_span<WordType, dynamic_extent>(end() - count, count);
+}
+
+// The result has a static extent whenever it can be computed at compile time
+template <class WordType, std::size_t Extent>
+template <std::size_t Offset, std::size_t Count>
+constexpr auto bit_span<WordType, Extent>::subspan() const {
+    static_assert(Extent == dynamic_extent || Offset <= Extent);
+    static_assert(Extent == dynamic_extent || Count == dynamic_extent || Offset + Count <= Extent);
+    constexpr std::size_t new_extent = Count != dynamic_extent
+        ? Count
+        : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+    assert(Offset <= size());
+    const size_type count = Count == dynamic_extent ? size() - Offset : Count;
+    assert(Offset + count <= size());
+    return bit_span<WordType, new_extent>(begin() + Offset, count);
+}
+
+template <class WordType, std::size_t Extent>
+constexpr bit_span<WordType, dynamic_extent>
+bit_span<WordType, Extent>::subspan(size_type offset, size_type count) const {
+    assert(offset <= size());
+    if (count == dynamic_extent) {
+        count = size() - offset;
+    }
+    assert(offset + count <= size());
+    return bit_span<WordType, dynamic_extent>(begin() + offset, count);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT SPAN: OPERATIONS --------------------------- //
+template <class WordType, std::size_t Extent>
+constexpr typename bit_span<WordType, Extent>::size_type
+bit_span<WordType, Extent>::count() const {
+    return static_cast<size_type>(::bit::count(begin(), end(), bit1));
+}
+
+template <class WordType, std::size_t Extent>
+constexpr const bit_span<WordType, Extent>&
+bit_span<WordType, Extent>::fill(bit_value bv) const {
+    ::bit::fill(begin(), end(), bv);
+    return *this;
+}
+
+template <class WordType, std::size_t Extent>
+constexpr const bit_span<WordType, Extent>&
+bit_span<WordType, Extent>::flip() const {
+    ::bit::transform(begin(), end(), begin(), std::bit_not<mutable_word_type>());
+    return *this;
+}
+
+template <class WordType, std::size_t Extent>
+template <class OtherWord, std::size_t OtherExtent>
+constexpr const bit_span<WordType, Extent>&
+bit_span<WordType, Extent>::operator&=(const bit_span<OtherWord, OtherExtent>& other) const {
+    assert(other.size() == size());
+    ::bit::transform(begin(), end(), _mutable_begin(other), begin(),
+            std::bit_and<mutable_word_type>());
+    return *this;
+}
+
+template <class WordType, std::size_t Extent>
+template <class OtherWord, std::size_t OtherExtent>
+constexpr const bit_span<WordType, Extent>&
+bit_span<WordType, Extent>::operator|=(const bit_span<OtherWord, OtherExtent>& other) const {
+    assert(other.size() == size());
+    ::bit::transform(begin(), end(), _mutable_begin(other), begin(),
+            std::bit_or<mutable_word_type>());
+    return *this;
+}
+
+template <class WordType, std::size_t Extent>
+template <class OtherWord, std::size_t OtherExtent>
+constexpr const bit_span<WordType, Extent>&
+bit_span<WordType, Extent>::operator^=(const bit_span<OtherWord, OtherExtent>& other) const {
+    assert(other.size() == size());
+    ::bit::transform(begin(), end(), _mutable_begin(other), begin(),
+            std::bit_xor<mutable_word_type>());
+    return *this;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_SPAN_HPP_INCLUDED
+// ========================================================================== //
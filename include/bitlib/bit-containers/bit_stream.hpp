@@ -0,0 +1,494 @@
+// =============================== BIT STREAM =============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        bit_stream.hpp
+// Description: Buffered writer and reader for variable-width bit fields
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _BIT_STREAM_HPP_INCLUDED
+#define _BIT_STREAM_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_vector.hpp"
+#include "bit_span.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+// --------------------------- BIT STREAM: DETAILS -------------------------- //
+// Mask of the n low bits, for 0 <= n <= 64
+constexpr std::uint64_t _low_mask(unsigned int n) noexcept {
+    return ((std::uint64_t(1) << (n & 63)) - 1) | -std::uint64_t(n >> 6);
+}
+
+// Right shift that gives 0 for shifts of 64
+constexpr std::uint64_t _shr(std::uint64_t x, unsigned int n) noexcept {
+    return n < 64 ? x >> n : 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+/* ******************************* BIT WRITER ******************************* */
+//! Appends fields of up to 64 bits, least significant bit first, through a
+//! 64-bit accumulator that is stored a whole accumulator at a time. It
+//! writes either at the end of a bit_vector, which grows as needed, or into
+//! a buffer of a fixed number of words. The bit_vector only holds exactly
+//! the written bits after flush(), which the destructor also calls.
+template <class WordType = std::uint64_t, class Allocator = std::allocator<WordType>>
+class bit_writer {
+    static_assert(64 % binary_digits<WordType>::value == 0,
+            "bit_writer needs words that divide the accumulator");
+
+    public:
+    using word_type = WordType;
+    using size_type = std::size_t;
+    using vector_type = bit_vector<WordType, Allocator>;
+
+    private:
+    static constexpr size_type digits = binary_digits<WordType>::value;
+    static constexpr size_type words_per_acc = 64 / digits;
+
+    vector_type* vec_ = nullptr;
+    WordType* first_ = nullptr;
+    WordType* cur_ = nullptr;
+    WordType* last_ = nullptr;
+    std::uint64_t acc_ = 0;
+    unsigned int used_ = 0;
+
+    void emit();
+    void grow(size_type min_words);
+
+    public:
+    // Lifecycle
+    explicit bit_writer(vector_type& out);
+    bit_writer(WordType* words, size_type num_words) noexcept;
+    bit_writer(const bit_writer&) = delete;
+    bit_writer& operator=(const bit_writer&) = delete;
+    ~bit_writer();
+
+    // Writing
+    void put(std::uint64_t value, unsigned int nbits);
+    template <unsigned int N>
+    void put(std::uint64_t value);
+    void put(bit_value value);
+    void put_unary(std::uint64_t count);
+    void flush();
+
+    // Status
+    size_type size() const noexcept;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT WRITER: LIFECYCLE -------------------------- //
+// Continues after the last bit of out
+template <class WordType, class Allocator>
+bit_writer<WordType, Allocator>::bit_writer(vector_type& out)
+: vec_(&out) {
+    const size_type full = out.size() / digits;
+    const unsigned int tail = out.size() % digits;
+    first_ = out.data();
+    cur_ = first_ + full;
+    last_ = first_ + (out.size() + digits - 1) / digits;
+    if (tail != 0) {
+        acc_ = static_cast<std::uint64_t>(*cur_) & _low_mask(tail);
+        used_ = tail;
+    }
+}
+
+// Writes from the start of the buffer, and throws std::length_error once it
+// would overflow
+template <class WordType, class Allocator>
+bit_writer<WordType, Allocator>::bit_writer(WordType* words, size_type num_words) noexcept
+: first_(words), cur_(words), last_(words + num_words) {
+}
+
+// Errors of the final flush are dropped, call flush() to see them
+template <class WordType, class Allocator>
+bit_writer<WordType, Allocator>::~bit_writer() {
+    try {
+        flush();
+    } catch (...) {
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT WRITER: WRITING --------------------------- //
+// Writes the nbits low bits of value, 0 <= nbits <= 64
+template <class WordType, class Allocator>
+inline void bit_writer<WordType, Allocator>::put(std::uint64_t value, unsigned int nbits) {
+    assert(nbits <= 64);
+    value &= _low_mask(nbits);
+    acc_ |= value << used_;
+    used_ += nbits;
+    if (used_ >= 64) {
+        emit();
+        used_ -= 64;
+        acc_ = _shr(value, nbits - used_);
+    }
+}
+
+// Same as put(value, N), with the masks and shifts known at compile time
+template <class WordType, class Allocator>
+template <unsigned int N>
+inline void bit_writer<WordType, Allocator>::put(std::uint64_t value) {
+    static_assert(N > 0 && N <= 64, "bit_writer writes between 1 and 64 bits");
+    if constexpr (N < 64) {
+        value &= (std::uint64_t(1) << N) - 1;
+    }
+    acc_ |= value << used_;
+    used_ += N;
+    if (used_ >= 64) {
+        emit();
+        used_ -= 64;
+        acc_ = _shr(value, N - used_);
+    }
+}
+
+template <class WordType, class Allocator>
+inline void bit_writer<WordType, Allocator>::put(bit_value value) {
+    put<1>(static_cast<bool>(value));
+}
+
+// Writes count zeros followed by a one
+template <class WordType, class Allocator>
+inline void bit_writer<WordType, Allocator>::put_unary(std::uint64_t count) {
+    for (; count >= 64; count -= 64) {
+        put<64>(0);
+    }
+    put(std::uint64_t(1) << count, static_cast<unsigned int>(count) + 1);
+}
+
+// Stores the pending bits without advancing, so that writing can go on
+// afterwards
+template <class WordType, class Allocator>
+void bit_writer<WordType, Allocator>::flush() {
+    const size_type pending = (used_ + digits - 1) / digits;
+    if (static_cast<size_type>(last_ - cur_) < pending) {
+        grow(pending);
+    }
+    for (size_type i = 0; i < pending; ++i) {
+        cur_[i] = static_cast<WordType>(acc_ >> (i * digits));
+    }
+    if (vec_ != nullptr) {
+        const size_type written = cur_ - first_;
+        vec_->resize(size());
+        first_ = vec_->data();
+        cur_ = first_ + written;
+        last_ = cur_ + pending;
+    }
+}
+
+// Stores the full accumulator
+template <class WordType, class Allocator>
+inline void bit_writer<WordType, Allocator>::emit() {
+    if (static_cast<size_type>(last_ - cur_) < words_per_acc) {
+        grow(words_per_acc);
+    }
+    if constexpr (digits == 64) {
+        *cur_ = static_cast<WordType>(acc_);
+    } else {
+        for (size_type i = 0; i < words_per_acc; ++i) {
+            cur_[i] = static_cast<WordType>(acc_ >> (i * digits));
+        }
+    }
+    cur_ += words_per_acc;
+}
+
+// Makes room for min_words more words, doubling the vector
+template <class WordType, class Allocator>
+void bit_writer<WordType, Allocator>::grow(size_type min_words) {
+    if (vec_ == nullptr) {
+        throw std::length_error("bit_writer: buffer is full");
+    }
+    const size_type written = cur_ - first_;
+    const size_type words = std::max<size_type>({
+        2 * static_cast<size_type>(last_ - first_),
+        written + min_words,
+        size_type(8)});
+    vec_->resize(words * digits);
+    first_ = vec_->data();
+    cur_ = first_ + written;
+    last_ = first_ + words;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- BIT WRITER: STATUS --------------------------- //
+// Number of bits written, including those of the vector it started from
+template <class WordType, class Allocator>
+inline typename bit_writer<WordType, Allocator>::size_type
+bit_writer<WordType, Allocator>::size() const noexcept {
+    return static_cast<size_type>(cur_ - first_) * digits + used_;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+/* ******************************* BIT READER ******************************* */
+//! Reads fields of up to 64 bits, least significant bit first, from
+//! words loaded into a 64-bit accumulator, which is the mirror of
+//! bit_writer. Reading past the end throws std::out_of_range.
+template <class WordType = std::uint64_t>
+class bit_reader {
+    static_assert(64 % binary_digits<WordType>::value == 0,
+            "bit_reader needs words that divide the accumulator");
+
+    public:
+    using word_type = WordType;
+    using size_type = std::size_t;
+
+    private:
+    static constexpr size_type digits = binary_digits<WordType>::value;
+
+    const WordType* next_ = nullptr;
+    size_type remaining_ = 0;
+    size_type length_ = 0;
+    std::uint64_t acc_ = 0;
+    unsigned int avail_ = 0;
+
+    void refill() noexcept;
+    std::uint64_t get_slow(unsigned int nbits);
+    size_type get_unary_slow();
+
+    public:
+    // Lifecycle
+    bit_reader() noexcept = default;
+    bit_reader(const WordType* words, size_type bit_length) noexcept;
+    template <class Allocator>
+    explicit bit_reader(const bit_vector<WordType, Allocator>& bv) noexcept;
+    template <class SpanWord, std::size_t Extent>
+    explicit bit_reader(bit_span<SpanWord, Extent> span);
+
+    // Reading
+    std::uint64_t get(unsigned int nbits);
+    template <unsigned int N>
+    std::uint64_t get();
+    bit_value get_bit();
+    size_type get_unary();
+    std::uint64_t peek(unsigned int nbits) const;
+    void skip(size_type nbits);
+
+    // Status
+    size_type position() const noexcept;
+    size_type remaining() const noexcept;
+    bool empty() const noexcept;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- BIT READER: LIFECYCLE -------------------------- //
+template <class WordType>
+bit_reader<WordType>::bit_reader(const WordType* words, size_type bit_length) noexcept
+: next_(words), remaining_(bit_length), length_(bit_length) {
+}
+
+template <class WordType>
+template <class Allocator>
+bit_reader<WordType>::bit_reader(const bit_vector<WordType, Allocator>& bv) noexcept
+: bit_reader(bv.data(), bv.size()) {
+}
+
+// Positions are relative to the start of the span
+template <class WordType>
+template <class SpanWord, std::size_t Extent>
+bit_reader<WordType>::bit_reader(bit_span<SpanWord, Extent> span)
+: bit_reader(span.data(), span.offset() + span.size()) {
+    static_assert(std::is_same<std::remove_const_t<SpanWord>, WordType>::value,
+            "bit_reader and bit_span word types must be equal");
+    skip(span.offset());
+    length_ = span.size();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------- BIT READER: READING --------------------------- //
+// Reads nbits bits, 0 <= nbits <= 64
+template <class WordType>
+inline std::uint64_t bit_reader<WordType>::get(unsigned int nbits) {
+    assert(nbits <= 64);
+    if (nbits <= avail_) {
+        const std::uint64_t value = acc_ & _low_mask(nbits);
+        acc_ = _shr(acc_, nbits);
+        avail_ -= nbits;
+        return value;
+    }
+    return get_slow(nbits);
+}
+
+// Same as get(N), with the masks and shifts known at compile time
+template <class WordType>
+template <unsigned int N>
+inline std::uint64_t bit_reader<WordType>::get() {
+    static_assert(N > 0 && N <= 64, "bit_reader reads between 1 and 64 bits");
+    if (N <= avail_) {
+        if constexpr (N == 64) {
+            avail_ = 0;
+            return acc_;
+        } else {
+            const std::uint64_t value = acc_ & ((std::uint64_t(1) << N) - 1);
+            acc_ >>= N;
+            avail_ -= N;
+            return value;
+        }
+    }
+    return get_slow(N);
+}
+
+template <class WordType>
+inline bit_value bit_reader<WordType>::get_bit() {
+    return bit_value(static_cast<bool>(get<1>()));
+}
+
+// Reads zeros up to the next one, which is consumed as well, and returns
+// their number. The zeros are counted a whole accumulator at a time.
+template <class WordType>
+inline typename bit_reader<WordType>::size_type bit_reader<WordType>::get_unary() {
+    const std::uint64_t bits = acc_ & _low_mask(avail_);
+    if (bits != 0) {
+        const unsigned int zeros = static_cast<unsigned int>(_tzcnt(bits));
+        acc_ = _shr(acc_, zeros + 1);
+        avail_ -= zeros + 1;
+        return zeros;
+    }
+    return get_unary_slow();
+}
+
+// Returns the next nbits bits without consuming them
+template <class WordType>
+std::uint64_t bit_reader<WordType>::peek(unsigned int nbits) const {
+    assert(nbits <= 64);
+    if (nbits <= avail_) {
+        return acc_ & _low_mask(nbits);
+    }
+    if (nbits > remaining()) {
+        throw std::out_of_range("bit_reader: read past the end");
+    }
+    std::uint64_t value = acc_ & _low_mask(avail_);
+    const WordType* it = next_;
+    for (unsigned int shift = avail_; shift < nbits; shift += digits) {
+        value |= static_cast<std::uint64_t>(*it++) << shift;
+    }
+    return value & _low_mask(nbits);
+}
+
+// Skips nbits bits, loading only the words after the skipped ones
+template <class WordType>
+void bit_reader<WordType>::skip(size_type nbits) {
+    if (nbits <= avail_) {
+        acc_ = _shr(acc_, static_cast<unsigned int>(nbits));
+        avail_ -= static_cast<unsigned int>(nbits);
+        return;
+    }
+    if (nbits > remaining()) {
+        throw std::out_of_range("bit_reader: skip past the end");
+    }
+    nbits -= avail_;
+    acc_ = 0;
+    avail_ = 0;
+    const size_type words = nbits / digits;
+    next_ += words;
+    remaining_ -= words * digits;
+    get(static_cast<unsigned int>(nbits % digits));
+}
+
+// Loads as many words as fit in the empty accumulator
+template <class WordType>
+inline void bit_reader<WordType>::refill() noexcept {
+    acc_ = 0;
+    avail_ = 0;
+    while (avail_ < 64 && remaining_ != 0) {
+        acc_ |= static_cast<std::uint64_t>(*next_++) << avail_;
+        const unsigned int loaded = static_cast<unsigned int>(std::min<size_type>(digits, remaining_));
+        avail_ += loaded;
+        remaining_ -= loaded;
+    }
+}
+
+// Reads the bits left in the accumulator, and the rest after a refill
+template <class WordType>
+std::uint64_t bit_reader<WordType>::get_slow(unsigned int nbits) {
+    if (nbits > remaining()) {
+        throw std::out_of_range("bit_reader: read past the end");
+    }
+    const unsigned int have = avail_;
+    std::uint64_t value = acc_ & _low_mask(have);
+    refill();
+    const unsigned int need = nbits - have;
+    value |= (acc_ & _low_mask(need)) << have;
+    acc_ = _shr(acc_, need);
+    avail_ -= need;
+    return value;
+}
+
+// Counts the zeros left in the accumulator and in the following words
+template <class WordType>
+typename bit_reader<WordType>::size_type bit_reader<WordType>::get_unary_slow() {
+    size_type zeros = avail_;
+    for (;;) {
+        refill();
+        if (avail_ == 0) {
+            throw std::out_of_range("bit_reader: unterminated unary code");
+        }
+        const std::uint64_t bits = acc_ & _low_mask(avail_);
+        if (bits != 0) {
+            const unsigned int tail = static_cast<unsigned int>(_tzcnt(bits));
+            acc_ = _shr(acc_, tail + 1);
+            avail_ -= tail + 1;
+            return zeros + tail;
+        }
+        zeros += avail_;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- BIT READER: STATUS --------------------------- //
+template <class WordType>
+inline typename bit_reader<WordType>::size_type
+bit_reader<WordType>::position() const noexcept {
+    return length_ - remaining();
+}
+
+// Number of bits left to read
+template <class WordType>
+inline typename bit_reader<WordType>::size_type
+bit_reader<WordType>::remaining() const noexcept {
+    return remaining_ + avail_;
+}
+
+template <class WordType>
+inline bool bit_reader<WordType>::empty() const noexcept {
+    return remaining() == 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _BIT_STREAM_HPP_INCLUDED
+// ========================================================================== //
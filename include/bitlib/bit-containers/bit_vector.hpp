@@ -18,11 +18,17 @@
 #include <string>
 #include <iostream>
 #include <algorithm>
+#include <functional>
 #include <vector>
 #include <type_traits>
+#include <utility>
+#if __cplusplus >= 202002L
+#include <compare>
+#endif
 // Project sources
 #include "bitlib/bit-iterator/bit.hpp"
 #include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bit_expression.hpp"
 // Third-party libraries
 // Miscellaneous
 namespace bit {
@@ -31,7 +37,16 @@ namespace bit {
 
 
 /* ****************************** BIT VECTOR ****************************** */
+//! Size of a bit_vector combined with one of another size
+enum class length_policy {
+    pad,      // the longer size, the missing bits of the shorter being zeros
+    truncate  // the shorter size
+};
+
+
 //! A bit-vector with a similar interface to std::vector<bool>
+// The bits of the last word past the end are kept at zero, so that growing
+// never has to clear them and whole words can be read as they are.
 template<class WordType, class Allocator = std::allocator<WordType>>
 class bit_vector {
     private:
@@ -41,10 +56,19 @@ class bit_vector {
 
         // TODO are privates always inlined?
         // @brief Get the number of words needed to represet num_bits bits
-        constexpr uint64_t word_count(unsigned int num_bits) {
+        static constexpr size_t word_count(size_t num_bits) {
             return ((num_bits + digits - 1) / digits);
         }
 
+        // Grows the words to hold num_bits bits. The capacity at least
+        // doubles whenever it runs out, so that repeated appends take
+        // amortized constant time whatever the growth policy of the
+        // underlying vector.
+        constexpr void grow_words(size_t num_bits);
+
+        // Zeroes the bits of the last word past the end
+        constexpr void clear_tail() noexcept;
+
         // Iterator pair constructor specializations
         // Passing in iterator over bool
         template<class RandomAccessIt>
@@ -84,8 +108,8 @@ class bit_vector {
         using reference = bit_reference<WordType>;
         using const_reference = const reference;
         using pointer = bit_pointer<WordType>;
-        using iterator = bit_iterator<typename std::vector<WordType>::iterator>;
-        using const_iterator = bit_iterator<const typename std::vector<WordType>::const_iterator>;
+        using iterator = bit_iterator<typename std::vector<WordType, Allocator>::iterator>;
+        using const_iterator = bit_iterator<const typename std::vector<WordType, Allocator>::const_iterator>;
 
 
         /*
@@ -112,12 +136,14 @@ class bit_vector {
                 const Allocator& alloc=Allocator());
         constexpr bit_vector(const bit_vector<WordType, Allocator>& other) = default;
         constexpr bit_vector(const bit_vector<WordType, Allocator>& other, const Allocator& alloc);
-        constexpr bit_vector(const bit_vector<WordType, Allocator>&& other) noexcept;
-        constexpr bit_vector(const bit_vector<WordType, Allocator>&& other, const Allocator& alloc);
+        constexpr bit_vector(bit_vector<WordType, Allocator>&& other) noexcept;
+        constexpr bit_vector(bit_vector<WordType, Allocator>&& other, const Allocator& alloc);
         constexpr bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc=Allocator());
         constexpr bit_vector(std::initializer_list<bool> init, const Allocator& alloc=Allocator());
         constexpr bit_vector(std::initializer_list<WordType> init, const Allocator& alloc=Allocator());
         constexpr bit_vector(std::string_view s);
+        template<class Expression>
+        constexpr bit_vector(const bit_expression<Expression>& expr, const Allocator& alloc=Allocator());
 
 #if __cplusplus == 201703L
         ~bit_vector();
@@ -130,7 +156,12 @@ class bit_vector {
          * Assignment
          */
         constexpr bit_vector& operator=(const bit_vector<WordType, Allocator>& other) = default;
-        constexpr bit_vector& operator=(bit_vector<WordType, Allocator>&& other) noexcept;
+        constexpr bit_vector& operator=(bit_vector<WordType, Allocator>&& other) noexcept(
+                std::is_nothrow_move_assignable<std::vector<WordType, Allocator>>::value);
+        template<class Expression>
+        constexpr bit_vector& operator=(const bit_expression<Expression>& expr);
+        constexpr void swap(bit_vector<WordType, Allocator>& other) noexcept;
+        constexpr allocator_type get_allocator() const noexcept;
 
 
         /*
@@ -183,6 +214,27 @@ class bit_vector {
         constexpr void resize(size_type count);
         constexpr void resize(size_type count, const value_type& value);
 
+        // Replaces each bit b by binary_op(b, o), o being the matching bit
+        // of other, a word at a time. The operators pad the shorter vector.
+        template<class BinaryOperation>
+        constexpr bit_vector& combine(
+                const bit_vector& other,
+                BinaryOperation binary_op,
+                length_policy policy = length_policy::pad);
+        constexpr bit_vector& operator&=(const bit_vector& other);
+        constexpr bit_vector& operator|=(const bit_vector& other);
+        constexpr bit_vector& operator^=(const bit_vector& other);
+        constexpr bit_vector& operator-=(const bit_vector& other);
+
+        // Bulk appends, which write whole words rather than single bits.
+        // The appended range must not come from this vector.
+        template<class RandomAccessIt>
+        constexpr void append(
+                bit_iterator<RandomAccessIt> first,
+                bit_iterator<RandomAccessIt> last);
+        constexpr void append_words(const WordType* words, size_type count);
+        constexpr void append(const value_type& value, size_type count);
+
 
         /*
          * Helper functions
@@ -195,6 +247,93 @@ class bit_vector {
             //return os << bv.debug_string(bv.cbegin(), bv.cend());;
         //}
 };
+
+template<class WordType, class Allocator>
+constexpr void swap(
+        bit_vector<WordType, Allocator>& lhs,
+        bit_vector<WordType, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+
+// Bit vectors are the operands of the bitwise expressions
+template<class WordType, class Allocator>
+constexpr bit_words_expression<WordType> _as_bit_expression(
+        const bit_vector<WordType, Allocator>& bv) noexcept {
+    return bit_words_expression<WordType>(bv.data(), bv.size());
+}
+
+// Bit vectors of the same size are equal when their words are, as the bits
+// past the end are zeros
+template<class WordType, class Allocator>
+constexpr bool operator==(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    const std::size_t num_words = (lhs.size() + digits - 1) / digits;
+    return lhs.size() == rhs.size()
+        && std::equal(lhs.data(), lhs.data() + num_words, rhs.data());
+}
+
+template<class WordType, class Allocator>
+constexpr bool operator!=(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return !(lhs == rhs);
+}
+
+// Negative, zero or positive as lhs comes before, is equal to or comes after
+// rhs in lexicographical order, from their first mismatch
+template<class WordType, class Allocator>
+constexpr int _bit_vector_compare(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    const bit_iterator<const WordType*> first1(lhs.data());
+    const bit_iterator<const WordType*> first2(rhs.data());
+    const auto last1 = first1 + std::min(lhs.size(), rhs.size());
+    const auto mismatches = mismatch(first1, last1, first2);
+    if (mismatches.first != last1) {
+        return *mismatches.first == bit0 ? -1 : 1;
+    }
+    return (lhs.size() > rhs.size()) - (lhs.size() < rhs.size());
+}
+
+// Bit vectors are ordered lexicographically, as std::vector<bool> is
+template<class WordType, class Allocator>
+constexpr bool operator<(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return _bit_vector_compare(lhs, rhs) < 0;
+}
+
+template<class WordType, class Allocator>
+constexpr bool operator<=(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return _bit_vector_compare(lhs, rhs) <= 0;
+}
+
+template<class WordType, class Allocator>
+constexpr bool operator>(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return _bit_vector_compare(lhs, rhs) > 0;
+}
+
+template<class WordType, class Allocator>
+constexpr bool operator>=(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return _bit_vector_compare(lhs, rhs) >= 0;
+}
+
+#if __cplusplus >= 202002L
+template<class WordType, class Allocator>
+constexpr std::strong_ordering operator<=>(
+        const bit_vector<WordType, Allocator>& lhs,
+        const bit_vector<WordType, Allocator>& rhs) {
+    return _bit_vector_compare(lhs, rhs) <=> 0;
+}
+#endif
 /* ************************************************************************** */
 
 
@@ -209,8 +348,9 @@ constexpr bit_vector<WordType, Allocator>::bit_vector(const Allocator& alloc) no
 template<class WordType, class Allocator>
 constexpr bit_vector<WordType, Allocator>::bit_vector(size_type count, value_type bit_val, const Allocator& alloc)
     : word_vector(word_count(count), static_cast<WordType>(bit_val == bit1 ? -1 : 0), alloc),
-      length_(count)
-      {}
+      length_(count) {
+    clear_tail();
+}
 
 template<class WordType, class Allocator>
 constexpr bit_vector<WordType, Allocator>::bit_vector(size_type count, const Allocator& alloc)
@@ -223,7 +363,7 @@ constexpr bit_vector<WordType, Allocator>::bit_vector(
         bit_iterator<RandomAccessIt> first,
         bit_iterator<RandomAccessIt> last,
         const Allocator& alloc)
-    : word_vector(distance(first, last), alloc), length_(distance(first, last)) {
+    : word_vector(word_count(distance(first, last)), alloc), length_(distance(first, last)) {
     copy(first, last, this->begin());
 }
 
@@ -242,12 +382,24 @@ constexpr bit_vector<WordType, Allocator>::bit_vector(
 }
 
 template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(const bit_vector<WordType, Allocator>&& other) noexcept
-    : word_vector(std::move(other.word_vector)), length_(other.length_) {}
+constexpr bit_vector<WordType, Allocator>::bit_vector(const bit_vector<WordType, Allocator>& other, const Allocator& alloc)
+    : word_vector(other.word_vector, alloc), length_(other.length_) {}
 
+// Takes over the words of other, which is left empty
 template<class WordType, class Allocator>
-constexpr bit_vector<WordType, Allocator>::bit_vector(const bit_vector<WordType, Allocator>&& other, const Allocator& alloc)
-    : word_vector(std::move(other.word_vector), alloc), length_(other.length_) {}
+constexpr bit_vector<WordType, Allocator>::bit_vector(bit_vector<WordType, Allocator>&& other) noexcept
+    : word_vector(std::move(other.word_vector)), length_(other.length_) {
+    other.length_ = 0;
+}
+
+// Takes over the words of other if alloc compares equal to its allocator,
+// and moves them one by one into new storage otherwise
+template<class WordType, class Allocator>
+constexpr bit_vector<WordType, Allocator>::bit_vector(bit_vector<WordType, Allocator>&& other, const Allocator& alloc)
+    : word_vector(std::move(other.word_vector), alloc), length_(other.length_) {
+    other.word_vector.clear();
+    other.length_ = 0;
+}
 
 template<class WordType, class Allocator>
 constexpr bit_vector<WordType, Allocator>::bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc)
@@ -275,7 +427,7 @@ constexpr bit_vector<WordType, Allocator>::bit_vector(
 template<class WordType, class Allocator>
 constexpr bit_vector<WordType, Allocator>::bit_vector(std::string_view s) {
     this->length_ = std::count(s.begin(), s.end(), '0') + std::count(s.begin(), s.end(), '1');
-    this->word_vector = std::vector<WordType, Allocator>(this->length_);
+    this->word_vector = std::vector<WordType, Allocator>(word_count(this->length_));
     size_type i = 0;
     for (char c : s) {
         if (c == '0') {
@@ -300,8 +452,8 @@ constexpr bit_vector<WordType, Allocator>::range_constructor(
         RandomAccessIt first,
         RandomAccessIt last,
         const Allocator& alloc) {
-    word_vector = std::vector<WordType, Allocator>(std::distance(first, last), alloc);
     length_ = std::distance(first, last);
+    word_vector = std::vector<WordType, Allocator>(word_count(length_), alloc);
     std::transform(
             first,
             last,
@@ -327,6 +479,16 @@ constexpr bit_vector<WordType, Allocator>::range_constructor(
     length_ = digits * std::distance(first, last);
 }
 
+// Evaluates the expression in one pass over the words
+template<class WordType, class Allocator>
+template<class Expression>
+constexpr bit_vector<WordType, Allocator>::bit_vector(
+        const bit_expression<Expression>& expr,
+        const Allocator& alloc)
+    : word_vector(word_count(expr.derived().size()), alloc), length_(expr.derived().size()) {
+    _assign_bit_expression(word_vector.data(), expr.derived());
+}
+
 template<class WordType, class Allocator>
 #if __cplusplus == 201703L
 bit_vector<WordType, Allocator>::~bit_vector() {
@@ -342,12 +504,43 @@ constexpr bit_vector<WordType, Allocator>::~bit_vector() {
 // ------------------------ BIT VECTOR: ASSIGNMENT ------------------------ //
 template<class WordType, class Allocator>
 constexpr bit_vector<WordType, Allocator>&
-bit_vector<WordType, Allocator>::operator=(bit_vector<WordType, Allocator>&& other) noexcept {
-    length_ = other.length_;
-    word_vector = std::move(other.word_vector);
-    other.length_ = 0;
+bit_vector<WordType, Allocator>::operator=(bit_vector<WordType, Allocator>&& other) noexcept(
+        std::is_nothrow_move_assignable<std::vector<WordType, Allocator>>::value) {
+    if (this != &other) {
+        word_vector = std::move(other.word_vector);
+        length_ = other.length_;
+        // Words moved one by one between unequal allocators stay behind
+        other.word_vector.clear();
+        other.length_ = 0;
+    }
     return *this;
 }
+
+// The expression may refer to this vector, whose words are then updated in
+// place, as the operands all have the size of the result
+template<class WordType, class Allocator>
+template<class Expression>
+constexpr bit_vector<WordType, Allocator>&
+bit_vector<WordType, Allocator>::operator=(const bit_expression<Expression>& expr) {
+    static_assert(std::is_same<typename Expression::word_type, WordType>::value,
+            "bit expressions are assigned to vectors of the same word type");
+    word_vector.resize(word_count(expr.derived().size()));
+    length_ = expr.derived().size();
+    _assign_bit_expression(word_vector.data(), expr.derived());
+    return *this;
+}
+
+template<class WordType, class Allocator>
+constexpr void bit_vector<WordType, Allocator>::swap(bit_vector<WordType, Allocator>& other) noexcept {
+    word_vector.swap(other.word_vector);
+    std::swap(length_, other.length_);
+}
+
+template<class WordType, class Allocator>
+constexpr typename bit_vector<WordType, Allocator>::allocator_type
+bit_vector<WordType, Allocator>::get_allocator() const noexcept {
+    return word_vector.get_allocator();
+}
 // -------------------------------------------------------------------------- //
 
 
@@ -518,7 +711,6 @@ bit_vector<WordType, Allocator>::insert(
     return begin() + d;
 }
 
-// TODO should use std::insert to maintain the constant amortized time.
 template<class WordType, class Allocator>
 constexpr typename bit_vector<WordType, Allocator>::iterator
 bit_vector<WordType, Allocator>::insert(
@@ -529,12 +721,7 @@ bit_vector<WordType, Allocator>::insert(
     if (count == 0) {
         return begin() + d;
     }
-    const float bits_available = word_vector.size() * digits;
-    const bool need_to_add = length_ + count > bits_available;
-    if (need_to_add) {
-        const auto words_to_add = word_count(length_ + count - bits_available);
-        word_vector.resize(word_vector.size() + words_to_add);
-    }
+    grow_words(length_ + count);
     length_ += count;
     shift_right(begin() + d, begin() + length_, count);
     fill(begin() + d, begin() + d + count, value);
@@ -552,12 +739,7 @@ bit_vector<WordType, Allocator>::insert(
     if (count == 0) {
         return begin() + d;
     }
-    const float bits_available = word_vector.size()*digits;
-    const auto need_to_add = length_ + count > bits_available;
-    if (need_to_add) {
-        const auto words_to_add = word_count(length_ + count - bits_available);
-        word_vector.resize(word_vector.size() + words_to_add);
-    }
+    grow_words(length_ + count);
     length_ += count;
     shift_right(begin() + d, begin() + length_, count);
     copy(first, last, begin() + d);
@@ -571,6 +753,8 @@ bit_vector<WordType, Allocator>::erase(iterator pos) {
     length_ -= 1;
     if (length_ % digits == 0) {
         word_vector.pop_back();
+    } else {
+        clear_tail();
     }
     return pos;
 }
@@ -586,15 +770,19 @@ bit_vector<WordType, Allocator>::erase(iterator first, iterator last) {
     shift_left(first, end(), count);
     length_ -= count;
     word_vector.resize(word_count(length_));
+    clear_tail();
     return begin() + d;
 }
 
 template<class WordType, class Allocator>
 constexpr void bit_vector<WordType, Allocator>::push_back(const value_type& value) {
-    if (this->word_vector.size()*digits == length_) {
-        word_vector.push_back(0U);
+    const WordType bit = static_cast<WordType>(value == bit1);
+    const size_type pos = length_ % digits;
+    if (pos == 0) {
+        word_vector.push_back(bit);
+    } else {
+        word_vector.back() |= static_cast<WordType>(bit << pos);
     }
-    begin()[length_] = value;
     length_ += 1;
     return;
 }
@@ -604,6 +792,8 @@ constexpr void bit_vector<WordType, Allocator>::pop_back() {
     length_ -= 1;
     if (length_ % digits == 0) {
         word_vector.pop_back();
+    } else {
+        clear_tail();
     }
     return;
 }
@@ -612,19 +802,122 @@ template<class WordType, class Allocator>
 constexpr void bit_vector<WordType, Allocator>::resize(size_type count) {
     word_vector.resize(word_count(count));
     length_ = count;
+    clear_tail();
     return;
 }
 
 template<class WordType, class Allocator>
 constexpr void bit_vector<WordType, Allocator>::resize(size_type count, const value_type& value) {
-    auto old_length = length_;
+    const size_type old_length = length_;
     word_vector.resize(word_count(count));
     length_ = count;
     if (length_ > old_length) {
-        fill(begin() + length_, end(), value);
+        fill(begin() + old_length, end(), value);
+    } else {
+        clear_tail();
     }
     return;
 }
+
+// The bits of this vector and of other past the end of the other one are
+// combined with zeros
+template<class WordType, class Allocator>
+template<class BinaryOperation>
+constexpr bit_vector<WordType, Allocator>& bit_vector<WordType, Allocator>::combine(
+        const bit_vector& other,
+        BinaryOperation binary_op,
+        length_policy policy) {
+    const size_type size = policy == length_policy::pad
+        ? std::max(length_, other.length_)
+        : std::min(length_, other.length_);
+    // Other keeps its words when it is this vector, as the sizes are equal
+    resize(size);
+    const size_type with_other = std::min(size, other.length_);
+    const bit_iterator<WordType*> first(word_vector.data());
+    transform_assign(first, first + with_other,
+            bit_iterator<const WordType*>(other.word_vector.data()), binary_op);
+    if (size > with_other) {
+        transform(first + with_other, first + size, first + with_other, [&binary_op](WordType word) {
+            return static_cast<WordType>(binary_op(word, WordType(0)));
+        });
+    }
+    clear_tail();
+    return *this;
+}
+
+template<class WordType, class Allocator>
+constexpr bit_vector<WordType, Allocator>&
+bit_vector<WordType, Allocator>::operator&=(const bit_vector& other) {
+    return combine(other, std::bit_and<WordType>());
+}
+
+template<class WordType, class Allocator>
+constexpr bit_vector<WordType, Allocator>&
+bit_vector<WordType, Allocator>::operator|=(const bit_vector& other) {
+    return combine(other, std::bit_or<WordType>());
+}
+
+template<class WordType, class Allocator>
+constexpr bit_vector<WordType, Allocator>&
+bit_vector<WordType, Allocator>::operator^=(const bit_vector& other) {
+    return combine(other, std::bit_xor<WordType>());
+}
+
+template<class WordType, class Allocator>
+constexpr bit_vector<WordType, Allocator>&
+bit_vector<WordType, Allocator>::operator-=(const bit_vector& other) {
+    return combine(other, bit_andnot<WordType>());
+}
+
+template<class WordType, class Allocator>
+template<class RandomAccessIt>
+constexpr void bit_vector<WordType, Allocator>::append(
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last) {
+    const size_type count = distance(first, last);
+    const size_type old_length = length_;
+    grow_words(length_ + count);
+    length_ += count;
+    copy(first, last, begin() + old_length);
+}
+
+template<class WordType, class Allocator>
+constexpr void bit_vector<WordType, Allocator>::append_words(const WordType* words, size_type count) {
+    const size_type old_length = length_;
+    grow_words(length_ + count * digits);
+    length_ += count * digits;
+    if (old_length % digits == 0) {
+        std::copy(words, words + count, word_vector.begin() + old_length / digits);
+    } else {
+        copy(bit_iterator<const WordType*>(words),
+             bit_iterator<const WordType*>(words + count),
+             begin() + old_length);
+    }
+}
+
+template<class WordType, class Allocator>
+constexpr void bit_vector<WordType, Allocator>::append(const value_type& value, size_type count) {
+    const size_type old_length = length_;
+    grow_words(length_ + count);
+    length_ += count;
+    fill(begin() + old_length, end(), value);
+}
+
+template<class WordType, class Allocator>
+constexpr void bit_vector<WordType, Allocator>::grow_words(size_t num_bits) {
+    const size_type words = word_count(num_bits);
+    if (words > word_vector.capacity()) {
+        word_vector.reserve(std::max(words, 2 * word_vector.capacity()));
+    }
+    word_vector.resize(words);
+}
+
+template<class WordType, class Allocator>
+constexpr void bit_vector<WordType, Allocator>::clear_tail() noexcept {
+    if (length_ % digits != 0 && !word_vector.empty()) {
+        word_vector.back() &= static_cast<WordType>((WordType(1) << (length_ % digits)) - 1);
+    }
+}
 // -------------------------------------------------------------------------- //
 
 
@@ -0,0 +1,950 @@
+// =========================== DYNAMIC BIT VECTOR =========================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        dynamic_bit_vector.hpp
+// Description: Bit vector with logarithmic insertion and erasure
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _DYNAMIC_BIT_VECTOR_HPP_INCLUDED
+#define _DYNAMIC_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm_details.hpp"
+#include "bit_span.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* *************************** DYNAMIC BIT VECTOR *************************** */
+//! A bit-vector stored as a B+tree of fixed-size blocks of words, where
+//! every inner node keeps the number of bits and of ones below each of its
+//! children. Inserting or erasing a bit only shifts the bits of one block,
+//! so edits, lookups and rank take O(log(n) + LeafWords) instead of the
+//! O(n) of bit_vector. The blocks are exposed in order through segments(),
+//! as bit_span objects that the algorithms can work on one at a time.
+template <
+    class WordType = std::uint64_t,
+    std::size_t LeafWords = 4096 / binary_digits<WordType>::value,
+    std::size_t Fanout = 16>
+class dynamic_bit_vector {
+    static_assert(LeafWords >= 2 && LeafWords % 2 == 0,
+            "dynamic_bit_vector splits blocks in two halves of whole words");
+    static_assert(Fanout >= 4, "dynamic_bit_vector needs a fanout of at least 4");
+
+    public:
+    using value_type = bit_value;
+    using word_type = WordType;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using segment_type = bit_span<const WordType>;
+    class segment_iterator;
+    struct segment_range;
+
+    private:
+    static constexpr size_type digits = binary_digits<WordType>::value;
+    static constexpr size_type leaf_bits = LeafWords * digits;
+
+    // Nodes are merged with a sibling once both fit in 3/4 of a node, so
+    // that a split is not undone by the next erasure
+    static constexpr size_type merge_bits = leaf_bits / 4 * 3;
+    static constexpr size_type merge_children = Fanout / 4 * 3;
+
+    struct _node {
+        bool is_leaf;
+    };
+
+    // The bits past size are always zero
+    struct _leaf : _node {
+        size_type size = 0;
+        _leaf* next = nullptr;
+        WordType words[LeafWords] = {};
+        _leaf() : _node{true} {}
+    };
+
+    // One extra slot holds a child before the node is split
+    struct _inner : _node {
+        std::size_t count = 0;
+        _node* children[Fanout + 1];
+        size_type sizes[Fanout + 1];
+        size_type ones[Fanout + 1];
+        _inner() : _node{false} {}
+    };
+
+    // Nodes allocated before an insert modifies the tree, so that a failed
+    // allocation leaves it untouched
+    struct _spare_nodes {
+        std::unique_ptr<_leaf> leaf;
+        std::vector<std::unique_ptr<_inner>> inners;
+        _inner* take_inner() noexcept {
+            _inner* inner = inners.back().release();
+            inners.pop_back();
+            return inner;
+        }
+    };
+
+    _node* root_ = nullptr;
+    _leaf* first_leaf_ = nullptr;
+    size_type size_ = 0;
+    size_type ones_ = 0;
+
+    // Leaves
+    static WordType _low_bits(WordType word, size_type n) noexcept {
+        return n < digits ? static_cast<WordType>(word & ((WordType(1) << n) - 1)) : word;
+    }
+    static size_type _leaf_ones(const _leaf* leaf, size_type last) noexcept;
+    static void _leaf_insert(_leaf* leaf, size_type pos, bool value) noexcept;
+    static bool _leaf_erase(_leaf* leaf, size_type pos) noexcept;
+    static void _leaf_append(_leaf* leaf, const _leaf* other) noexcept;
+    static _leaf* _split_leaf(_leaf* leaf, _leaf* right) noexcept;
+
+    // Inner nodes
+    static void _totals(const _node* node, size_type& size, size_type& ones) noexcept;
+    static void _insert_child(_inner* inner, std::size_t i, _node* child, size_type size, size_type ones) noexcept;
+    static void _remove_child(_inner* inner, std::size_t i) noexcept;
+    static _inner* _split_inner(_inner* inner, _inner* right) noexcept;
+    static void _merge_children(_inner* inner, std::size_t i) noexcept;
+
+    // Trees
+    static void _destroy(_node* node) noexcept;
+    static _node* _clone(const _node* node, _leaf*& last_leaf);
+    _spare_nodes _reserve_splits(size_type pos) const;
+    static _node* _insert(_node* node, size_type pos, bool value, _spare_nodes& spares) noexcept;
+    static bool _erase(_node* node, size_type pos) noexcept;
+    template <class Operation>
+    static int _update(_node* node, size_type pos, Operation op) noexcept;
+    const _leaf* _find(size_type& pos) const noexcept;
+    template <class RandomAccessIt>
+    void _build(bit_iterator<RandomAccessIt> first, size_type count);
+
+    public:
+    // Lifecycle
+    dynamic_bit_vector() noexcept = default;
+    explicit dynamic_bit_vector(size_type count, value_type value = bit0);
+    template <class RandomAccessIt>
+    dynamic_bit_vector(bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last);
+    dynamic_bit_vector(const dynamic_bit_vector& other);
+    dynamic_bit_vector(dynamic_bit_vector&& other) noexcept;
+    dynamic_bit_vector& operator=(dynamic_bit_vector other) noexcept;
+    ~dynamic_bit_vector();
+
+    // Element access
+    value_type operator[](size_type pos) const noexcept;
+    value_type at(size_type pos) const;
+    value_type front() const noexcept;
+    value_type back() const noexcept;
+
+    // Capacity
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    // Modifiers
+    void set(size_type pos, value_type value = bit1) noexcept;
+    void reset(size_type pos) noexcept;
+    void flip(size_type pos) noexcept;
+    void insert(size_type pos, value_type value);
+    value_type erase(size_type pos) noexcept;
+    void push_back(value_type value);
+    void pop_back() noexcept;
+    void clear() noexcept;
+    void swap(dynamic_bit_vector& other) noexcept;
+
+    // Queries
+    size_type count() const noexcept;
+    size_type rank(size_type pos) const noexcept;
+
+    // Segments
+    segment_range segments() const noexcept;
+};
+
+// Forward iterator over the blocks, in order, as spans of const words
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+class dynamic_bit_vector<WordType, LeafWords, Fanout>::segment_iterator {
+    friend class dynamic_bit_vector;
+    const _leaf* leaf_ = nullptr;
+    explicit segment_iterator(const _leaf* leaf) noexcept : leaf_(leaf) {}
+
+    public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = segment_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = segment_type;
+
+    segment_iterator() noexcept = default;
+    segment_type operator*() const noexcept {
+        return segment_type(leaf_->words, leaf_->size);
+    }
+    segment_iterator& operator++() noexcept {
+        leaf_ = leaf_->next;
+        return *this;
+    }
+    segment_iterator operator++(int) noexcept {
+        segment_iterator old = *this;
+        leaf_ = leaf_->next;
+        return old;
+    }
+    friend bool operator==(segment_iterator lhs, segment_iterator rhs) noexcept {
+        return lhs.leaf_ == rhs.leaf_;
+    }
+    friend bool operator!=(segment_iterator lhs, segment_iterator rhs) noexcept {
+        return lhs.leaf_ != rhs.leaf_;
+    }
+};
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+struct dynamic_bit_vector<WordType, LeafWords, Fanout>::segment_range {
+    segment_iterator first;
+    segment_iterator last;
+    segment_iterator begin() const noexcept {return first;}
+    segment_iterator end() const noexcept {return last;}
+};
+/* ************************************************************************** */
+
+
+
+// ----------------------- DYNAMIC BIT VECTOR: LEAVES ----------------------- //
+// Number of ones in [0, last) of a leaf
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::size_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf_ones(const _leaf* leaf, size_type last) noexcept {
+    size_type result = 0;
+    const size_type full = last / digits;
+    for (size_type w = 0; w < full; ++w) {
+        result += _popcnt(leaf->words[w]);
+    }
+    if (last % digits != 0) {
+        result += _popcnt(_low_bits(leaf->words[full], last % digits));
+    }
+    return result;
+}
+
+// Shifts the bits from pos up by one word at a time, and stores value at pos
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf_insert(
+        _leaf* leaf, size_type pos, bool value) noexcept {
+    assert(leaf->size < leaf_bits && pos <= leaf->size);
+    const size_type w = pos / digits;
+    const size_type b = pos % digits;
+    const size_type last_word = leaf->size / digits;
+    WordType carry = static_cast<WordType>(leaf->words[w] >> (digits - 1));
+    const WordType low = _low_bits(leaf->words[w], b);
+    leaf->words[w] = static_cast<WordType>(low
+            | static_cast<WordType>((leaf->words[w] ^ low) << 1)
+            | static_cast<WordType>(static_cast<WordType>(value) << b));
+    for (size_type k = w + 1; k <= last_word; ++k) {
+        const WordType next_carry = static_cast<WordType>(leaf->words[k] >> (digits - 1));
+        leaf->words[k] = static_cast<WordType>(static_cast<WordType>(leaf->words[k] << 1) | carry);
+        carry = next_carry;
+    }
+    ++leaf->size;
+}
+
+// Shifts the bits after pos down by one, and returns the bit at pos
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+bool dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf_erase(
+        _leaf* leaf, size_type pos) noexcept {
+    assert(pos < leaf->size);
+    const size_type w = pos / digits;
+    const size_type b = pos % digits;
+    const size_type last_word = (leaf->size - 1) / digits;
+    const bool value = (leaf->words[w] >> b) & 1;
+    WordType carry = 0;
+    for (size_type k = last_word; k > w; --k) {
+        const WordType next_carry = static_cast<WordType>(leaf->words[k] & 1);
+        leaf->words[k] = static_cast<WordType>((leaf->words[k] >> 1)
+                | static_cast<WordType>(carry << (digits - 1)));
+        carry = next_carry;
+    }
+    const WordType low = _low_bits(leaf->words[w], b);
+    leaf->words[w] = static_cast<WordType>(low
+            | static_cast<WordType>((leaf->words[w] >> 1) & ~_low_bits(static_cast<WordType>(-1), b))
+            | static_cast<WordType>(carry << (digits - 1)));
+    --leaf->size;
+    return value;
+}
+
+// Appends the bits of other, which must fit
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf_append(
+        _leaf* leaf, const _leaf* other) noexcept {
+    assert(leaf->size + other->size <= leaf_bits);
+    const size_type w = leaf->size / digits;
+    const size_type b = leaf->size % digits;
+    const size_type other_words = (other->size + digits - 1) / digits;
+    if (b == 0) {
+        std::memcpy(leaf->words + w, other->words, other_words * sizeof(WordType));
+    } else {
+        for (size_type k = 0; k < other_words; ++k) {
+            leaf->words[w + k] |= static_cast<WordType>(other->words[k] << b);
+            if (w + k + 1 < LeafWords) {
+                leaf->words[w + k + 1] |= static_cast<WordType>(other->words[k] >> (digits - b));
+            }
+        }
+    }
+    leaf->size += other->size;
+}
+
+// Moves the upper half of a full leaf into the empty leaf right, which
+// follows it
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf*
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_split_leaf(_leaf* leaf, _leaf* right) noexcept {
+    constexpr size_type half = LeafWords / 2;
+    std::memcpy(right->words, leaf->words + half, half * sizeof(WordType));
+    std::memset(leaf->words + half, 0, half * sizeof(WordType));
+    right->size = leaf->size - half * digits;
+    leaf->size = half * digits;
+    right->next = leaf->next;
+    leaf->next = right;
+    return right;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- DYNAMIC BIT VECTOR: INNER NODES --------------------- //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_totals(
+        const _node* node, size_type& size, size_type& ones) noexcept {
+    if (node->is_leaf) {
+        const _leaf* leaf = static_cast<const _leaf*>(node);
+        size = leaf->size;
+        ones = _leaf_ones(leaf, leaf->size);
+    } else {
+        const _inner* inner = static_cast<const _inner*>(node);
+        size = 0;
+        ones = 0;
+        for (std::size_t i = 0; i < inner->count; ++i) {
+            size += inner->sizes[i];
+            ones += inner->ones[i];
+        }
+    }
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_insert_child(
+        _inner* inner, std::size_t i, _node* child, size_type size, size_type ones) noexcept {
+    assert(inner->count <= Fanout);
+    for (std::size_t k = inner->count; k > i; --k) {
+        inner->children[k] = inner->children[k - 1];
+        inner->sizes[k] = inner->sizes[k - 1];
+        inner->ones[k] = inner->ones[k - 1];
+    }
+    inner->children[i] = child;
+    inner->sizes[i] = size;
+    inner->ones[i] = ones;
+    ++inner->count;
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_remove_child(
+        _inner* inner, std::size_t i) noexcept {
+    for (std::size_t k = i + 1; k < inner->count; ++k) {
+        inner->children[k - 1] = inner->children[k];
+        inner->sizes[k - 1] = inner->sizes[k];
+        inner->ones[k - 1] = inner->ones[k];
+    }
+    --inner->count;
+}
+
+// Moves the upper half of the children of an overfull node into the empty
+// node right
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_inner*
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_split_inner(_inner* inner, _inner* right) noexcept {
+    const std::size_t half = inner->count / 2;
+    for (std::size_t k = half; k < inner->count; ++k) {
+        right->children[k - half] = inner->children[k];
+        right->sizes[k - half] = inner->sizes[k];
+        right->ones[k - half] = inner->ones[k];
+    }
+    right->count = inner->count - half;
+    inner->count = half;
+    return right;
+}
+
+// Merges child i + 1 into child i when they are small enough together, and
+// drops empty leaves
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_merge_children(
+        _inner* inner, std::size_t i) noexcept {
+    _node* left = inner->children[i];
+    _node* right = inner->children[i + 1];
+    if (left->is_leaf) {
+        const size_type total = inner->sizes[i] + inner->sizes[i + 1];
+        if (total > merge_bits && inner->sizes[i] != 0 && inner->sizes[i + 1] != 0) {
+            return;
+        }
+        _leaf* left_leaf = static_cast<_leaf*>(left);
+        _leaf* right_leaf = static_cast<_leaf*>(right);
+        _leaf_append(left_leaf, right_leaf);
+        left_leaf->next = right_leaf->next;
+        delete right_leaf;
+    } else {
+        _inner* left_inner = static_cast<_inner*>(left);
+        _inner* right_inner = static_cast<_inner*>(right);
+        if (left_inner->count + right_inner->count > merge_children) {
+            return;
+        }
+        for (std::size_t k = 0; k < right_inner->count; ++k) {
+            left_inner->children[left_inner->count + k] = right_inner->children[k];
+            left_inner->sizes[left_inner->count + k] = right_inner->sizes[k];
+            left_inner->ones[left_inner->count + k] = right_inner->ones[k];
+        }
+        left_inner->count += right_inner->count;
+        delete right_inner;
+    }
+    inner->sizes[i] += inner->sizes[i + 1];
+    inner->ones[i] += inner->ones[i + 1];
+    _remove_child(inner, i + 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ DYNAMIC BIT VECTOR: TREES ----------------------- //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_destroy(_node* node) noexcept {
+    if (node == nullptr) {
+        return;
+    }
+    if (node->is_leaf) {
+        delete static_cast<_leaf*>(node);
+    } else {
+        _inner* inner = static_cast<_inner*>(node);
+        for (std::size_t i = 0; i < inner->count; ++i) {
+            _destroy(inner->children[i]);
+        }
+        delete inner;
+    }
+}
+
+// Copies a subtree, linking its leaves after last_leaf
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_node*
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_clone(const _node* node, _leaf*& last_leaf) {
+    if (node->is_leaf) {
+        _leaf* leaf = new _leaf(*static_cast<const _leaf*>(node));
+        leaf->next = nullptr;
+        if (last_leaf != nullptr) {
+            last_leaf->next = leaf;
+        }
+        last_leaf = leaf;
+        return leaf;
+    }
+    const _inner* inner = static_cast<const _inner*>(node);
+    _inner* copy = new _inner;
+    try {
+        for (; copy->count < inner->count; ++copy->count) {
+            copy->children[copy->count] = _clone(inner->children[copy->count], last_leaf);
+            copy->sizes[copy->count] = inner->sizes[copy->count];
+            copy->ones[copy->count] = inner->ones[copy->count];
+        }
+    } catch (...) {
+        _destroy(copy);
+        throw;
+    }
+    return copy;
+}
+
+// Allocates the nodes that an insert at pos splits off: the full leaf, the
+// full nodes right above it, and a new root when the whole path is full
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_spare_nodes
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_reserve_splits(size_type pos) const {
+    _spare_nodes spares;
+    std::size_t depth = 0;
+    std::size_t full_inners = 0;
+    const _node* node = root_;
+    while (!node->is_leaf) {
+        const _inner* inner = static_cast<const _inner*>(node);
+        full_inners = inner->count == Fanout ? full_inners + 1 : 0;
+        ++depth;
+        std::size_t i = 0;
+        while (i + 1 < inner->count && pos > inner->sizes[i]) {
+            pos -= inner->sizes[i];
+            ++i;
+        }
+        node = inner->children[i];
+    }
+    if (static_cast<const _leaf*>(node)->size == leaf_bits) {
+        spares.leaf.reset(new _leaf);
+        const std::size_t num_inners = full_inners + (full_inners == depth);
+        spares.inners.reserve(num_inners);
+        for (std::size_t k = 0; k < num_inners; ++k) {
+            spares.inners.emplace_back(new _inner);
+        }
+    }
+    return spares;
+}
+
+// Inserts into a subtree, and returns the new right sibling of node if it
+// had to be split. The new siblings are taken from spares.
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_node*
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_insert(
+        _node* node, size_type pos, bool value, _spare_nodes& spares) noexcept {
+    if (node->is_leaf) {
+        _leaf* leaf = static_cast<_leaf*>(node);
+        _leaf* right = nullptr;
+        if (leaf->size == leaf_bits) {
+            right = _split_leaf(leaf, spares.leaf.release());
+            if (pos > leaf->size) {
+                pos -= leaf->size;
+                leaf = right;
+            }
+        }
+        _leaf_insert(leaf, pos, value);
+        return right;
+    }
+    _inner* inner = static_cast<_inner*>(node);
+    std::size_t i = 0;
+    while (i + 1 < inner->count && pos > inner->sizes[i]) {
+        pos -= inner->sizes[i];
+        ++i;
+    }
+    _node* right = _insert(inner->children[i], pos, value, spares);
+    inner->sizes[i] += 1;
+    inner->ones[i] += value;
+    if (right == nullptr) {
+        return nullptr;
+    }
+    size_type right_size;
+    size_type right_ones;
+    _totals(right, right_size, right_ones);
+    inner->sizes[i] -= right_size;
+    inner->ones[i] -= right_ones;
+    _insert_child(inner, i + 1, right, right_size, right_ones);
+    return inner->count > Fanout ? _split_inner(inner, spares.take_inner()) : nullptr;
+}
+
+// Erases from a subtree, and returns the erased bit
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+bool dynamic_bit_vector<WordType, LeafWords, Fanout>::_erase(_node* node, size_type pos) noexcept {
+    if (node->is_leaf) {
+        return _leaf_erase(static_cast<_leaf*>(node), pos);
+    }
+    _inner* inner = static_cast<_inner*>(node);
+    std::size_t i = 0;
+    while (pos >= inner->sizes[i]) {
+        pos -= inner->sizes[i];
+        ++i;
+    }
+    const bool value = _erase(inner->children[i], pos);
+    inner->sizes[i] -= 1;
+    inner->ones[i] -= value;
+    if (inner->count > 1) {
+        _merge_children(inner, i + 1 < inner->count ? i : i - 1);
+    }
+    return value;
+}
+
+// Applies op to the word and mask of the bit at pos, and returns the change
+// in the number of ones
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+template <class Operation>
+int dynamic_bit_vector<WordType, LeafWords, Fanout>::_update(
+        _node* node, size_type pos, Operation op) noexcept {
+    if (node->is_leaf) {
+        WordType& word = static_cast<_leaf*>(node)->words[pos / digits];
+        const WordType mask = static_cast<WordType>(WordType(1) << (pos % digits));
+        const int before = (word & mask) != 0;
+        op(word, mask);
+        return ((word & mask) != 0) - before;
+    }
+    _inner* inner = static_cast<_inner*>(node);
+    std::size_t i = 0;
+    while (pos >= inner->sizes[i]) {
+        pos -= inner->sizes[i];
+        ++i;
+    }
+    const int delta = _update(inner->children[i], pos, op);
+    inner->ones[i] = delta < 0 ? inner->ones[i] - 1 : inner->ones[i] + delta;
+    return delta;
+}
+
+// Returns the leaf holding pos, and makes pos relative to it
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+const typename dynamic_bit_vector<WordType, LeafWords, Fanout>::_leaf*
+dynamic_bit_vector<WordType, LeafWords, Fanout>::_find(size_type& pos) const noexcept {
+    const _node* node = root_;
+    while (!node->is_leaf) {
+        const _inner* inner = static_cast<const _inner*>(node);
+        std::size_t i = 0;
+        while (pos >= inner->sizes[i]) {
+            pos -= inner->sizes[i];
+            ++i;
+        }
+        node = inner->children[i];
+    }
+    return static_cast<const _leaf*>(node);
+}
+
+// Fills full leaves with count bits from first, and builds the levels
+// above them
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+template <class RandomAccessIt>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::_build(
+        bit_iterator<RandomAccessIt> first, size_type count) {
+    using source_word = typename bit_iterator<RandomAccessIt>::word_type;
+    static_assert(std::is_same<std::remove_cv_t<source_word>, WordType>::value,
+            "dynamic_bit_vector is built from bits of the same word type");
+    // Reserved up front, so that a leaf is owned by level once allocated
+    const size_type num_leaves = (count + leaf_bits - 1) / leaf_bits;
+    std::vector<_node*> level;
+    std::vector<size_type> sizes;
+    std::vector<size_type> ones;
+    level.reserve(num_leaves);
+    sizes.reserve(num_leaves);
+    ones.reserve(num_leaves);
+    _leaf* first_leaf = nullptr;
+    try {
+        _leaf* last_leaf = nullptr;
+        for (size_type done = 0; done < count;) {
+            _leaf* leaf = new _leaf;
+            level.push_back(leaf);
+            if (last_leaf != nullptr) {
+                last_leaf->next = leaf;
+            } else {
+                first_leaf = leaf;
+            }
+            last_leaf = leaf;
+            leaf->size = std::min(leaf_bits, count - done);
+            for (size_type w = 0; w * digits < leaf->size; ++w) {
+                const size_type n = std::min(digits, leaf->size - w * digits);
+                leaf->words[w] = _low_bits(get_word<WordType>(first, n), n);
+                first += n;
+            }
+            done += leaf->size;
+            sizes.push_back(leaf->size);
+            ones.push_back(_leaf_ones(leaf, leaf->size));
+        }
+        // Groups of children are spread evenly over the nodes of a level.
+        // The whole level is allocated before any child is moved into it.
+        while (level.size() > 1) {
+            const std::size_t groups = (level.size() + Fanout - 1) / Fanout;
+            std::vector<_node*> parents;
+            std::vector<size_type> parent_sizes(groups);
+            std::vector<size_type> parent_ones(groups);
+            parents.reserve(groups);
+            try {
+                for (std::size_t g = 0; g < groups; ++g) {
+                    parents.push_back(new _inner);
+                }
+            } catch (...) {
+                for (_node* node : parents) {
+                    _destroy(node);
+                }
+                throw;
+            }
+            std::size_t k = 0;
+            for (std::size_t g = 0; g < groups; ++g) {
+                _inner* inner = static_cast<_inner*>(parents[g]);
+                const std::size_t end = (g + 1) * level.size() / groups;
+                for (; k < end; ++k) {
+                    _insert_child(inner, inner->count, level[k], sizes[k], ones[k]);
+                    parent_sizes[g] += sizes[k];
+                    parent_ones[g] += ones[k];
+                }
+            }
+            level.swap(parents);
+            sizes.swap(parent_sizes);
+            ones.swap(parent_ones);
+        }
+    } catch (...) {
+        for (_node* node : level) {
+            _destroy(node);
+        }
+        throw;
+    }
+    if (!level.empty()) {
+        root_ = level.front();
+        first_leaf_ = first_leaf;
+        size_ = count;
+        ones_ = ones.front();
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- DYNAMIC BIT VECTOR: LIFECYCLE --------------------- //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+dynamic_bit_vector<WordType, LeafWords, Fanout>::dynamic_bit_vector(size_type count, value_type value) {
+    const WordType word = value == bit1 ? static_cast<WordType>(-1) : WordType(0);
+    std::vector<WordType> words((count + digits - 1) / digits, word);
+    _build(bit_iterator<const WordType*>(words.data()), count);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+template <class RandomAccessIt>
+dynamic_bit_vector<WordType, LeafWords, Fanout>::dynamic_bit_vector(
+        bit_iterator<RandomAccessIt> first, bit_iterator<RandomAccessIt> last) {
+    _build(first, static_cast<size_type>(last - first));
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+dynamic_bit_vector<WordType, LeafWords, Fanout>::dynamic_bit_vector(const dynamic_bit_vector& other)
+: size_(other.size_), ones_(other.ones_) {
+    if (other.root_ != nullptr) {
+        _leaf* last_leaf = nullptr;
+        root_ = _clone(other.root_, last_leaf);
+        _node* node = root_;
+        while (!node->is_leaf) {
+            node = static_cast<_inner*>(node)->children[0];
+        }
+        first_leaf_ = static_cast<_leaf*>(node);
+    }
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+dynamic_bit_vector<WordType, LeafWords, Fanout>::dynamic_bit_vector(dynamic_bit_vector&& other) noexcept
+: root_(std::exchange(other.root_, nullptr)),
+  first_leaf_(std::exchange(other.first_leaf_, nullptr)),
+  size_(std::exchange(other.size_, 0)),
+  ones_(std::exchange(other.ones_, 0)) {
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+dynamic_bit_vector<WordType, LeafWords, Fanout>&
+dynamic_bit_vector<WordType, LeafWords, Fanout>::operator=(dynamic_bit_vector other) noexcept {
+    swap(other);
+    return *this;
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+dynamic_bit_vector<WordType, LeafWords, Fanout>::~dynamic_bit_vector() {
+    _destroy(root_);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- DYNAMIC BIT VECTOR: ELEMENT ACCESS ------------------ //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::value_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::operator[](size_type pos) const noexcept {
+    assert(pos < size_);
+    const _leaf* leaf = _find(pos);
+    return bit_value(leaf->words[pos / digits], pos % digits);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::value_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::at(size_type pos) const {
+    if (pos < size_) {
+        return (*this)[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::value_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::front() const noexcept {
+    return (*this)[0];
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::value_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::back() const noexcept {
+    return (*this)[size_ - 1];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- DYNAMIC BIT VECTOR: CAPACITY --------------------- //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+bool dynamic_bit_vector<WordType, LeafWords, Fanout>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::size_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::size() const noexcept {
+    return size_;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- DYNAMIC BIT VECTOR: MODIFIERS -------------------- //
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::set(size_type pos, value_type value) noexcept {
+    assert(pos < size_);
+    const WordType fill = value == bit1 ? static_cast<WordType>(-1) : WordType(0);
+    const int delta = _update(root_, pos, [fill](WordType& word, WordType mask) {
+        word = static_cast<WordType>((word & ~mask) | (fill & mask));
+    });
+    ones_ = delta < 0 ? ones_ - 1 : ones_ + delta;
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::reset(size_type pos) noexcept {
+    set(pos, bit0);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::flip(size_type pos) noexcept {
+    assert(pos < size_);
+    const int delta = _update(root_, pos, [](WordType& word, WordType mask) {
+        word ^= mask;
+    });
+    ones_ = delta < 0 ? ones_ - 1 : ones_ + delta;
+}
+
+// Inserts value before pos, splitting at most one node per level
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::insert(size_type pos, value_type value) {
+    assert(pos <= size_);
+    const bool b = value == bit1;
+    if (root_ == nullptr) {
+        first_leaf_ = new _leaf;
+        root_ = first_leaf_;
+    }
+    _spare_nodes spares = _reserve_splits(pos);
+    _node* right = _insert(root_, pos, b, spares);
+    if (right != nullptr) {
+        _inner* root = spares.take_inner();
+        size_type left_size;
+        size_type left_ones;
+        size_type right_size;
+        size_type right_ones;
+        _totals(root_, left_size, left_ones);
+        _totals(right, right_size, right_ones);
+        _insert_child(root, 0, root_, left_size, left_ones);
+        _insert_child(root, 1, right, right_size, right_ones);
+        root_ = root;
+    }
+    ++size_;
+    ones_ += b;
+}
+
+// Erases the bit at pos and returns it, merging small nodes on the way up
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::value_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::erase(size_type pos) noexcept {
+    assert(pos < size_);
+    const bool b = _erase(root_, pos);
+    while (!root_->is_leaf && static_cast<_inner*>(root_)->count == 1) {
+        _inner* root = static_cast<_inner*>(root_);
+        root_ = root->children[0];
+        delete root;
+    }
+    --size_;
+    ones_ -= b;
+    if (size_ == 0) {
+        clear();
+    }
+    return bit_value(b);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::push_back(value_type value) {
+    insert(size_, value);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::pop_back() noexcept {
+    erase(size_ - 1);
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::clear() noexcept {
+    _destroy(root_);
+    root_ = nullptr;
+    first_leaf_ = nullptr;
+    size_ = 0;
+    ones_ = 0;
+}
+
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+void dynamic_bit_vector<WordType, LeafWords, Fanout>::swap(dynamic_bit_vector& other) noexcept {
+    std::swap(root_, other.root_);
+    std::swap(first_leaf_, other.first_leaf_);
+    std::swap(size_, other.size_);
+    std::swap(ones_, other.ones_);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ DYNAMIC BIT VECTOR: QUERIES --------------------- //
+// Number of ones
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::size_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::count() const noexcept {
+    return ones_;
+}
+
+// Number of ones in [0, pos)
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::size_type
+dynamic_bit_vector<WordType, LeafWords, Fanout>::rank(size_type pos) const noexcept {
+    assert(pos <= size_);
+    if (pos == size_) {
+        return ones_;
+    }
+    size_type result = 0;
+    const _node* node = root_;
+    while (!node->is_leaf) {
+        const _inner* inner = static_cast<const _inner*>(node);
+        std::size_t i = 0;
+        while (pos >= inner->sizes[i]) {
+            result += inner->ones[i];
+            pos -= inner->sizes[i];
+            ++i;
+        }
+        node = inner->children[i];
+    }
+    return result + _leaf_ones(static_cast<const _leaf*>(node), pos);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------------- DYNAMIC BIT VECTOR: SEGMENTS --------------------- //
+// The blocks in order, each viewed as a bit_span
+template <class WordType, std::size_t LeafWords, std::size_t Fanout>
+typename dynamic_bit_vector<WordType, LeafWords, Fanout>::segment_range
+dynamic_bit_vector<WordType, LeafWords, Fanout>::segments() const noexcept {
+    return segment_range{segment_iterator(first_leaf_), segment_iterator(nullptr)};
+}
+
+// Calls f on each block of v in order, as a bit_span of const words, so
+// that algorithms run a block at a time
+template <class WordType, std::size_t LeafWords, std::size_t Fanout, class Function>
+Function for_each_segment(const dynamic_bit_vector<WordType, LeafWords, Fanout>& v, Function f) {
+    for (auto segment : v.segments()) {
+        f(segment);
+    }
+    return f;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _DYNAMIC_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,190 @@
+// ============================ EXTENT ALLOCATOR ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        extent_allocator.hpp
+// Description: Bitmap free-space manager for runs of contiguous blocks
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EXTENT_ALLOCATOR_HPP_INCLUDED
+#define _EXTENT_ALLOCATOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <memory>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bit_vector.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* **************************** EXTENT ALLOCATOR **************************** */
+//! How an extent_allocator picks among the free runs that are large enough
+enum class fit_policy {
+    first_fit,  // lowest addressed run, found with bit::find_run
+    best_fit    // smallest run, ties broken by address
+};
+
+//! Hands out extents of n contiguous blocks from a fixed pool of blocks.
+//
+// Each block is one bit of a bit_vector: bit0 is a free block and bit1 is a
+// used one. Extents are searched for at the word level and are marked and
+// released with bit::fill.
+template<class WordType = std::uint64_t, class Allocator = std::allocator<WordType>>
+class extent_allocator {
+    private:
+        using const_iterator = bit_iterator<const WordType*>;
+
+        bit_vector<WordType, Allocator> blocks_;
+        size_t used_ = 0;
+        fit_policy policy_;
+
+        size_t _first_fit(size_t n);
+        size_t _best_fit(size_t n);
+        const_iterator _cbegin() const noexcept {return const_iterator(blocks_.data());}
+
+    public:
+        using size_type = std::size_t;
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        explicit extent_allocator(
+                size_type num_blocks,
+                fit_policy policy = fit_policy::first_fit,
+                const Allocator& alloc = Allocator());
+
+        // Returns the first block of the extent, or npos if no free run of n
+        // blocks exists
+        size_type allocate(size_type n);
+        size_type allocate(size_type n, fit_policy policy);
+        void deallocate(size_type start, size_type n);
+
+        bool is_free(size_type start, size_type n) const;
+        size_type largest_free_extent() const;
+
+        fit_policy policy() const noexcept {return policy_;}
+        size_type capacity() const noexcept {return blocks_.size();}
+        size_type used() const noexcept {return used_;}
+        size_type available() const noexcept {return blocks_.size() - used_;}
+        const bit_vector<WordType, Allocator>& bitmap() const noexcept {return blocks_;}
+};
+/* ************************************************************************** */
+
+
+
+// ----------------------- EXTENT ALLOCATOR: LIFECYCLE ---------------------- //
+template<class WordType, class Allocator>
+extent_allocator<WordType, Allocator>::extent_allocator(
+        size_type num_blocks,
+        fit_policy policy,
+        const Allocator& alloc)
+    : blocks_(num_blocks, bit0, alloc), policy_(policy) {}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- EXTENT ALLOCATOR: ALLOCATION ---------------------- //
+template<class WordType, class Allocator>
+typename extent_allocator<WordType, Allocator>::size_type
+extent_allocator<WordType, Allocator>::allocate(size_type n) {
+    return allocate(n, policy_);
+}
+
+template<class WordType, class Allocator>
+typename extent_allocator<WordType, Allocator>::size_type
+extent_allocator<WordType, Allocator>::allocate(size_type n, fit_policy policy) {
+    if (n == 0 || n > available()) {
+        return npos;
+    }
+    const size_t start = policy == fit_policy::best_fit ? _best_fit(n) : _first_fit(n);
+    if (start != npos) {
+        fill(blocks_.begin() + start, blocks_.begin() + start + n, bit1);
+        used_ += n;
+    }
+    return start;
+}
+
+template<class WordType, class Allocator>
+void extent_allocator<WordType, Allocator>::deallocate(size_type start, size_type n) {
+    assert(start + n <= capacity());
+    assert(count(blocks_.begin() + start, blocks_.begin() + start + n, bit1)
+            == static_cast<std::ptrdiff_t>(n));
+    fill(blocks_.begin() + start, blocks_.begin() + start + n, bit0);
+    used_ -= n;
+}
+
+template<class WordType, class Allocator>
+bool extent_allocator<WordType, Allocator>::is_free(size_type start, size_type n) const {
+    if (start > capacity() || n > capacity() - start) {
+        return false;
+    }
+    const auto first = _cbegin() + start;
+    const auto last = first + n;
+    return find(first, last, bit1) == last;
+}
+
+template<class WordType, class Allocator>
+typename extent_allocator<WordType, Allocator>::size_type
+extent_allocator<WordType, Allocator>::largest_free_extent() const {
+    if (available() == 0) {
+        return 0;
+    }
+    const auto last = _cbegin() + capacity();
+    size_t largest = 0;
+    for (auto it = find(_cbegin(), last, bit0); it != last; ) {
+        const auto run_end = find(it, last, bit1);
+        largest = std::max(largest, static_cast<size_t>(distance(it, run_end)));
+        it = run_end == last ? last : find(run_end, last, bit0);
+    }
+    return largest;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ----------------- EXTENT ALLOCATOR: IMPLEMENTATION DETAILS --------------- //
+template<class WordType, class Allocator>
+size_t extent_allocator<WordType, Allocator>::_first_fit(size_t n) {
+    const auto first = _cbegin();
+    const auto last = first + capacity();
+    const auto it = find_run(first, last, bit0, n);
+    return it == last ? npos : static_cast<size_t>(distance(first, it));
+}
+
+// Walks the free runs from one to the next with bit::find, keeping the
+// smallest one which is large enough. An exact fit ends the search early.
+template<class WordType, class Allocator>
+size_t extent_allocator<WordType, Allocator>::_best_fit(size_t n) {
+    const auto first = _cbegin();
+    const auto last = first + capacity();
+    size_t best = npos;
+    size_t best_length = npos;
+    for (auto it = find_run(first, last, bit0, n); it != last; ) {
+        const auto run_end = find(it, last, bit1);
+        const size_t length = distance(it, run_end);
+        if (length < best_length) {
+            best = distance(first, it);
+            best_length = length;
+            if (length == n) {
+                break;
+            }
+        }
+        it = run_end == last ? last : find_run(run_end, last, bit0, n);
+    }
+    return best;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _EXTENT_ALLOCATOR_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,255 @@
+// ============================== ID ALLOCATOR ============================== //
+// Project:     The Experimental Bit Algorithms Library
+// \file        id_allocator.hpp
+// Description: Lock-free bitmap allocator for integer ids
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ID_ALLOCATOR_HPP_INCLUDED
+#define _ID_ALLOCATOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <thread>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "atomic_bit_vector.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ****************************** ID ALLOCATOR ****************************** */
+//! Hands out ids in [0, capacity) from many threads without locking.
+//
+// Ids are bits of an atomic_bit_vector: a set bit is an allocated id. A
+// thread looks for a word with a zero bit, starting from its
+// own hint cursor so that threads spread over the pool, and claims a bit with
+// a CAS on that word. The optional summary level keeps one bit per word which
+// is set while the word is full, so that nearly-full pools skip over full
+// words without reading them.
+template<class WordType = std::uint64_t, class Allocator = std::allocator<WordType>>
+class id_allocator {
+    private:
+        static constexpr size_t digits = binary_digits<WordType>::value;
+        static constexpr WordType all_ones = static_cast<WordType>(-1);
+
+        // Hint cursors live on separate cache lines to avoid false sharing
+        struct alignas(64) hint_cursor {
+            std::atomic<size_t> word{0};
+        };
+
+        atomic_bit_vector<WordType, Allocator> ids_;
+        atomic_bit_vector<WordType, Allocator> full_;
+        size_t capacity_;
+        size_t num_hints_;
+        std::unique_ptr<hint_cursor[]> hints_;
+
+        size_t _hint_slot() const noexcept;
+        size_t _find_candidate(size_t first_word, size_t last_word, bool use_summary) const noexcept;
+        size_t _claim(size_t word_idx) noexcept;
+        void _mark_full(size_t word_idx) noexcept;
+        size_t _allocate_from(size_t start_word, bool use_summary) noexcept;
+
+    public:
+        using size_type = std::size_t;
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+        // hint_slots == 0 picks one cursor per hardware thread
+        explicit id_allocator(
+                size_type capacity,
+                bool use_summary = true,
+                size_type hint_slots = 0);
+
+        size_type allocate() noexcept;
+        void deallocate(size_type id) noexcept;
+        bool is_allocated(size_type id) const noexcept;
+
+        bool has_summary() const noexcept {return full_.size() != 0;}
+        size_type capacity() const noexcept {return capacity_;}
+        // Relaxed: concurrent allocations may or may not be observed
+        size_type allocated() const noexcept;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- ID ALLOCATOR: LIFECYCLE ------------------------ //
+template<class WordType, class Allocator>
+id_allocator<WordType, Allocator>::id_allocator(
+        size_type capacity,
+        bool use_summary,
+        size_type hint_slots)
+    : ids_(capacity),
+      full_(use_summary ? ids_.word_size() : 0),
+      capacity_(capacity),
+      num_hints_(hint_slots ? hint_slots : std::max(1u, std::thread::hardware_concurrency())),
+      hints_(new hint_cursor[num_hints_]) {
+    // Padding bits of the last word are permanently allocated
+    if (capacity_ % digits) {
+        const size_t last = ids_.word_size() - 1;
+        ids_.fetch_or_word(last, static_cast<WordType>(all_ones << (capacity_ % digits)));
+    }
+    // Spread the cursors over the pool
+    for (size_t i = 0; i < num_hints_; ++i) {
+        hints_[i].word.store(i * ids_.word_size() / num_hints_, std::memory_order_relaxed);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ ID ALLOCATOR: ALLOCATION ------------------------ //
+template<class WordType, class Allocator>
+typename id_allocator<WordType, Allocator>::size_type
+id_allocator<WordType, Allocator>::allocate() noexcept {
+    if (ids_.word_size() == 0) {
+        return npos;
+    }
+    hint_cursor& hint = hints_[_hint_slot()];
+    const size_t start = hint.word.load(std::memory_order_relaxed);
+    size_t id = _allocate_from(start, has_summary());
+    // The summary is only a hint: a full scan of the ids themselves decides
+    // whether the pool is really exhausted.
+    if (id == npos && has_summary()) {
+        id = _allocate_from(0, false);
+    }
+    if (id != npos) {
+        hint.word.store(id / digits, std::memory_order_relaxed);
+    }
+    return id;
+}
+
+template<class WordType, class Allocator>
+void id_allocator<WordType, Allocator>::deallocate(size_type id) noexcept {
+    assert(id < capacity_);
+    const size_t word_idx = id / digits;
+    const WordType mask = static_cast<WordType>(1) << (id % digits);
+    const WordType prev = ids_.fetch_and_word(word_idx, static_cast<WordType>(~mask), std::memory_order_release);
+    assert(prev & mask);
+    if (prev == all_ones && has_summary()) {
+        full_.fetch_reset(word_idx);
+    }
+}
+
+template<class WordType, class Allocator>
+bool id_allocator<WordType, Allocator>::is_allocated(size_type id) const noexcept {
+    return id < capacity_ && ids_.test(id, std::memory_order_acquire);
+}
+
+template<class WordType, class Allocator>
+typename id_allocator<WordType, Allocator>::size_type
+id_allocator<WordType, Allocator>::allocated() const noexcept {
+    return ids_.count();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- ID ALLOCATOR: IMPLEMENTATION DETAILS ---------------- //
+// Threads are numbered round-robin the first time they allocate, which
+// spreads them more evenly than hashing std::thread::id
+template<class WordType, class Allocator>
+size_t id_allocator<WordType, Allocator>::_hint_slot() const noexcept {
+    static std::atomic<size_t> next_thread{0};
+    static thread_local const size_t thread_number =
+        next_thread.fetch_add(1, std::memory_order_relaxed);
+    return thread_number % num_hints_;
+}
+
+// Index of the first word in [first_word, last_word) which may have a zero
+// bit, or last_word if there is none. Every word is read exactly once: the
+// generic algorithms may read a word twice, which is unsafe while other
+// threads are writing to it.
+template<class WordType, class Allocator>
+size_t id_allocator<WordType, Allocator>::_find_candidate(
+        size_t first_word,
+        size_t last_word,
+        bool use_summary) const noexcept {
+    if (!use_summary) {
+        while (first_word < last_word
+                && ids_.load_word(first_word, std::memory_order_relaxed) == all_ones) {
+            ++first_word;
+        }
+        return first_word;
+    }
+    while (first_word < last_word) {
+        const size_t offset = first_word % digits;
+        const WordType not_full = static_cast<WordType>(
+                ~full_.load_word(first_word / digits, std::memory_order_relaxed)) >> offset;
+        if (not_full) {
+            return std::min(first_word + _tzcnt(not_full), last_word);
+        }
+        first_word += digits - offset;
+    }
+    return last_word;
+}
+
+// Claims the lowest zero bit of a word, or returns npos if it is full
+template<class WordType, class Allocator>
+size_t id_allocator<WordType, Allocator>::_claim(size_t word_idx) noexcept {
+    WordType cur = ids_.load_word(word_idx, std::memory_order_relaxed);
+    while (cur != all_ones) {
+        const WordType bit_mask = static_cast<WordType>(1) << _tzcnt(static_cast<WordType>(~cur));
+        const WordType desired = cur | bit_mask;
+        if (ids_.compare_exchange_word(word_idx, cur, desired, std::memory_order_acq_rel)) {
+            if (desired == all_ones && has_summary()) {
+                _mark_full(word_idx);
+            }
+            return word_idx * digits + _tzcnt(bit_mask);
+        }
+    }
+    if (has_summary()) {
+        _mark_full(word_idx);
+    }
+    return npos;
+}
+
+// Sets the summary bit of a word, then re-checks the word so that a
+// concurrent deallocate which cleared the summary bit first is not lost
+template<class WordType, class Allocator>
+void id_allocator<WordType, Allocator>::_mark_full(size_t word_idx) noexcept {
+    full_.test_and_set(word_idx);
+    if (ids_.load_word(word_idx) != all_ones) {
+        full_.fetch_reset(word_idx);
+    }
+}
+
+// Scans [start_word, end) and then [0, start_word)
+template<class WordType, class Allocator>
+size_t id_allocator<WordType, Allocator>::_allocate_from(
+        size_t start_word,
+        bool use_summary) noexcept {
+    const size_t num_words = ids_.word_size();
+    start_word = std::min(start_word, num_words - 1);
+    const size_t bounds[2][2] = {{start_word, num_words}, {0, start_word}};
+    for (const auto& bound : bounds) {
+        size_t word_idx = _find_candidate(bound[0], bound[1], use_summary);
+        while (word_idx < bound[1]) {
+            const size_t id = _claim(word_idx);
+            if (id != npos) {
+                return id;
+            }
+            word_idx = _find_candidate(word_idx + 1, bound[1], use_summary);
+        }
+    }
+    return npos;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _ID_ALLOCATOR_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,386 @@
+// ============================ MMAP BIT VECTOR ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        mmap_bit_vector.hpp
+// Description: Bit vector stored in a memory-mapped file
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _MMAP_BIT_VECTOR_HPP_INCLUDED
+#define _MMAP_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+// Some algorithm headers include bitlib.hpp, so bit_algorithm.hpp may not be
+// complete yet when this header is reached
+#include "bitlib/bit-algorithms/fill.hpp"
+// Third-party libraries
+// Miscellaneous
+#if defined(__unix__) || defined(__APPLE__)
+#define _BITLIB_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+namespace bit {
+// ========================================================================== //
+
+
+
+#ifdef _BITLIB_MMAP
+/* **************************** MMAP BIT VECTOR ***************************** */
+// How the file of a mmap_bit_vector is opened
+enum class mmap_mode {
+    read_only,  // the file must exist, and the bits cannot be modified
+    read_write  // the file is created if it does not exist
+};
+
+// Access pattern hints passed on to madvise
+enum class mmap_advice {
+    normal,
+    sequential,
+    random,
+    willneed,
+    dontneed,
+    hugepage    // back the mapping with transparent huge pages, where supported
+};
+
+//! A bit vector whose words are the contents of a file, mapped shared into
+//! memory, so that the algorithms run directly on the file pages.
+//
+// The file holds the words only, not the length in bits: a reopened vector
+// has the length of the whole words of the file, so a length which is not a
+// multiple of the word size is rounded up, with the extra bits at 0. Changes
+// reach the file when the kernel writes the pages back, or
+// when sync() is called. Errors from the system calls are thrown as
+// std::system_error.
+template<class WordType = std::uint64_t>
+class mmap_bit_vector {
+    private:
+        static constexpr std::size_t digits = binary_digits<WordType>::value;
+        int fd_ = -1;
+        mmap_mode mode_ = mmap_mode::read_only;
+        WordType* words_ = nullptr;
+        std::size_t num_words_ = 0;
+        std::size_t length_ = 0;
+
+        static constexpr std::size_t word_count(std::size_t num_bits) {
+            return (num_bits + digits - 1) / digits;
+        }
+        [[noreturn]] static void throw_errno(const char* what) {
+            throw std::system_error(errno, std::generic_category(),
+                    std::string("mmap_bit_vector: ") + what);
+        }
+        void open(const std::string& path, mmap_mode mode);
+        void map(std::size_t num_words);
+        void remap(std::size_t num_words);
+        void close() noexcept;
+
+    public:
+        /*
+         * Types and typedefs
+         */
+        using value_type = bit_value;
+        using base_type = WordType;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = bit_reference<WordType>;
+        using const_reference = bit_value;
+        using pointer = bit_pointer<WordType>;
+        using iterator = bit_iterator<WordType*>;
+        using const_iterator = bit_iterator<const WordType*>;
+
+
+        /*
+         * Constructors, moves and destructor
+         */
+        mmap_bit_vector() noexcept = default;
+        // Maps the whole file
+        explicit mmap_bit_vector(const std::string& path, mmap_mode mode = mmap_mode::read_only);
+        // Maps the file for writing, creating it if needed, and resizes it to
+        // count bits
+        mmap_bit_vector(const std::string& path, size_type count);
+        mmap_bit_vector(const mmap_bit_vector&) = delete;
+        mmap_bit_vector(mmap_bit_vector&& other) noexcept;
+        mmap_bit_vector& operator=(const mmap_bit_vector&) = delete;
+        mmap_bit_vector& operator=(mmap_bit_vector&& other) noexcept;
+        ~mmap_bit_vector();
+
+
+        /*
+         * Element Access
+         */
+        reference operator[](size_type pos) {return begin()[pos];}
+        const_reference operator[](size_type pos) const {return begin()[pos];}
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        WordType* data() noexcept {return words_;}
+        const WordType* data() const noexcept {return words_;}
+
+
+        /*
+         * Iterators
+         */
+        iterator begin() noexcept {return iterator(words_);}
+        iterator end() noexcept {return begin() + length_;}
+        const_iterator begin() const noexcept {return const_iterator(words_);}
+        const_iterator end() const noexcept {return begin() + length_;}
+        const_iterator cbegin() const noexcept {return begin();}
+        const_iterator cend() const noexcept {return end();}
+
+
+        /*
+         * Capacity
+         */
+        bool empty() const noexcept {return length_ == 0;}
+        size_type size() const noexcept {return length_;}
+        size_type capacity() const noexcept {return num_words_ * digits;}
+        bool is_open() const noexcept {return fd_ != -1;}
+        bool writable() const noexcept {return mode_ == mmap_mode::read_write;}
+
+
+        /*
+         * Modifiers and file operations
+         */
+        // Grows or shrinks the file, and the mapping with it. New bits are 0,
+        // and so are the bits of the last word past the new length, which
+        // the file keeps.
+        void resize(size_type count);
+        void advise(mmap_advice advice);
+        // Writes the dirty pages back to the file, waiting for the writes
+        // unless async is set
+        void sync(bool async = false);
+};
+/* ************************************************************************** */
+
+
+
+// ---------------------- MMAP BIT VECTOR: LIFECYCLE ------------------------ //
+template<class WordType>
+mmap_bit_vector<WordType>::mmap_bit_vector(const std::string& path, mmap_mode mode) {
+    open(path, mode);
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) {
+        const int err = errno;
+        close();
+        errno = err;
+        throw_errno("fstat");
+    }
+    const std::size_t num_words = static_cast<std::size_t>(st.st_size) / sizeof(WordType);
+    try {
+        map(num_words);
+    } catch (...) {
+        close();
+        throw;
+    }
+    length_ = num_words * digits;
+}
+
+template<class WordType>
+mmap_bit_vector<WordType>::mmap_bit_vector(const std::string& path, size_type count)
+    : mmap_bit_vector(path, mmap_mode::read_write) {
+    resize(count);
+}
+
+template<class WordType>
+mmap_bit_vector<WordType>::mmap_bit_vector(mmap_bit_vector&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      mode_(other.mode_),
+      words_(std::exchange(other.words_, nullptr)),
+      num_words_(std::exchange(other.num_words_, 0)),
+      length_(std::exchange(other.length_, 0)) {}
+
+template<class WordType>
+mmap_bit_vector<WordType>& mmap_bit_vector<WordType>::operator=(mmap_bit_vector&& other) noexcept {
+    if (this != &other) {
+        close();
+        fd_ = std::exchange(other.fd_, -1);
+        mode_ = other.mode_;
+        words_ = std::exchange(other.words_, nullptr);
+        num_words_ = std::exchange(other.num_words_, 0);
+        length_ = std::exchange(other.length_, 0);
+    }
+    return *this;
+}
+
+template<class WordType>
+mmap_bit_vector<WordType>::~mmap_bit_vector() {
+    close();
+}
+
+template<class WordType>
+void mmap_bit_vector<WordType>::open(const std::string& path, mmap_mode mode) {
+    const int flags = mode == mmap_mode::read_only ? O_RDONLY : (O_RDWR | O_CREAT);
+    fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+    if (fd_ == -1) {
+        throw_errno("open");
+    }
+    mode_ = mode;
+}
+
+// An empty file is not mapped at all
+template<class WordType>
+void mmap_bit_vector<WordType>::map(std::size_t num_words) {
+    if (num_words != 0) {
+        const int prot = writable() ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* addr = ::mmap(nullptr, num_words * sizeof(WordType), prot, MAP_SHARED, fd_, 0);
+        if (addr == MAP_FAILED) {
+            throw_errno("mmap");
+        }
+        words_ = static_cast<WordType*>(addr);
+    }
+    num_words_ = num_words;
+}
+
+// Moves the mapping to num_words words of the file, which has already been
+// resized. Linux can grow it in place or move it without tearing it down.
+template<class WordType>
+void mmap_bit_vector<WordType>::remap(std::size_t num_words) {
+#ifdef __linux__
+    if (words_ != nullptr && num_words != 0) {
+        void* addr = ::mremap(words_, num_words_ * sizeof(WordType),
+                num_words * sizeof(WordType), MREMAP_MAYMOVE);
+        if (addr == MAP_FAILED) {
+            throw_errno("mremap");
+        }
+        words_ = static_cast<WordType*>(addr);
+        num_words_ = num_words;
+        return;
+    }
+#endif
+    if (words_ != nullptr) {
+        ::munmap(words_, num_words_ * sizeof(WordType));
+        words_ = nullptr;
+        num_words_ = 0;
+    }
+    map(num_words);
+}
+
+template<class WordType>
+void mmap_bit_vector<WordType>::close() noexcept {
+    if (words_ != nullptr) {
+        ::munmap(words_, num_words_ * sizeof(WordType));
+        words_ = nullptr;
+    }
+    if (fd_ != -1) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    num_words_ = 0;
+    length_ = 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ MMAP BIT VECTOR: ACCESS ------------------------- //
+template<class WordType>
+typename mmap_bit_vector<WordType>::reference
+mmap_bit_vector<WordType>::at(size_type pos) {
+    if (pos < length_) {
+        return begin()[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template<class WordType>
+typename mmap_bit_vector<WordType>::const_reference
+mmap_bit_vector<WordType>::at(size_type pos) const {
+    if (pos < length_) {
+        return begin()[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- MMAP BIT VECTOR: MODIFYING ------------------------ //
+// The file is extended with ftruncate, which zero-fills the new words. The
+// bits past the length in the last word are kept at 0, so that growing and
+// reopening the file both find them cleared.
+template<class WordType>
+void mmap_bit_vector<WordType>::resize(size_type count) {
+    if (!writable()) {
+        throw std::system_error(std::make_error_code(std::errc::bad_file_descriptor),
+                "mmap_bit_vector: resize of a read-only mapping");
+    }
+    const std::size_t num_words = word_count(count);
+    if (num_words != num_words_) {
+        if (num_words > num_words_) {
+            if (::ftruncate(fd_, static_cast<off_t>(num_words * sizeof(WordType))) != 0) {
+                throw_errno("ftruncate");
+            }
+            remap(num_words);
+        } else {
+            remap(num_words);
+            if (::ftruncate(fd_, static_cast<off_t>(num_words * sizeof(WordType))) != 0) {
+                throw_errno("ftruncate");
+            }
+        }
+    }
+    if (count < length_ && count % digits != 0) {
+        fill(begin() + count, begin() + num_words * digits, bit0);
+    }
+    length_ = count;
+}
+
+template<class WordType>
+void mmap_bit_vector<WordType>::advise(mmap_advice advice) {
+    if (words_ == nullptr) {
+        return;
+    }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+        case mmap_advice::normal: flag = MADV_NORMAL; break;
+        case mmap_advice::sequential: flag = MADV_SEQUENTIAL; break;
+        case mmap_advice::random: flag = MADV_RANDOM; break;
+        case mmap_advice::willneed: flag = MADV_WILLNEED; break;
+        case mmap_advice::dontneed: flag = MADV_DONTNEED; break;
+        case mmap_advice::hugepage:
+#ifdef MADV_HUGEPAGE
+            flag = MADV_HUGEPAGE;
+            break;
+#else
+            return;
+#endif
+    }
+    if (::madvise(words_, num_words_ * sizeof(WordType), flag) != 0) {
+        throw_errno("madvise");
+    }
+}
+
+template<class WordType>
+void mmap_bit_vector<WordType>::sync(bool async) {
+    if (words_ == nullptr) {
+        return;
+    }
+    if (::msync(words_, num_words_ * sizeof(WordType), async ? MS_ASYNC : MS_SYNC) != 0) {
+        throw_errno("msync");
+    }
+}
+// -------------------------------------------------------------------------- //
+#endif // _BITLIB_MMAP
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _MMAP_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,408 @@
+// ============================== SERIALIZATION ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        serialization.hpp
+// Description: Versioned, checksummed binary format for bit vectors
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SERIALIZATION_HPP_INCLUDED
+#define _SERIALIZATION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_vector.hpp"
+#include "bit_span.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ****************************** BIT FORMAT ******************************** */
+// A serialized bit vector is a 64-byte header followed by the words, so
+// that the payload of a file mapped at a page boundary is 64-byte aligned
+// and can be used in place:
+//
+//   offset  size  field
+//        0     8  magic "BITLIB\x1a\n"
+//        8     2  format version
+//       10     1  bits per word
+//       11     1  byte order of the words (0: little, 1: big endian)
+//       12     4  header size, which is the payload offset
+//       16     8  length in bits
+//       24     8  payload size in bytes
+//       32     8  XXH64 of the payload
+//       40     8  XXH64 of bytes [0, 40) of the header
+//       48    16  reserved, zero
+//
+// Header fields are little endian. The words are written in the byte order
+// of the machine, and the bits past the length in the last word are zero.
+struct bit_format {
+    static constexpr std::array<char, 8> magic = {'B', 'I', 'T', 'L', 'I', 'B', '\x1a', '\n'};
+    static constexpr std::uint16_t version = 1;
+    static constexpr std::size_t header_size = 64;
+    static constexpr std::uint8_t little_endian = 0;
+    static constexpr std::uint8_t big_endian = 1;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    static constexpr std::uint8_t native_endian = big_endian;
+#else
+    static constexpr std::uint8_t native_endian = little_endian;
+#endif
+};
+
+// Thrown when a buffer or stream does not hold a valid serialized vector
+class format_error : public std::runtime_error {
+    public:
+    using std::runtime_error::runtime_error;
+};
+
+// Decoded header
+struct bit_format_header {
+    std::uint16_t version = bit_format::version;
+    std::uint8_t word_bits = 0;
+    std::uint8_t endianness = bit_format::native_endian;
+    std::uint32_t header_size = bit_format::header_size;
+    std::uint64_t bit_length = 0;
+    std::uint64_t payload_bytes = 0;
+    std::uint64_t payload_checksum = 0;
+};
+/* ************************************************************************** */
+
+
+
+// --------------------------------- XXH64 ---------------------------------- //
+// Reference XXH64, used for the checksums
+struct _xxh64 {
+    static constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+    static constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr std::uint64_t prime3 = 0x165667B19E3779F9ULL;
+    static constexpr std::uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr std::uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+    static std::uint64_t rotl(std::uint64_t x, int r) noexcept {
+        return (x << r) | (x >> (64 - r));
+    }
+    static std::uint64_t read64(const unsigned char* p) noexcept {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) {
+            v = (v << 8) | p[i];
+        }
+        return v;
+    }
+    static std::uint32_t read32(const unsigned char* p) noexcept {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+            | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+    static std::uint64_t round(std::uint64_t acc, std::uint64_t input) noexcept {
+        acc += input * prime2;
+        return rotl(acc, 31) * prime1;
+    }
+    static std::uint64_t merge(std::uint64_t acc, std::uint64_t val) noexcept {
+        acc ^= round(0, val);
+        return acc * prime1 + prime4;
+    }
+};
+
+// Streaming XXH64: the input is fed in consecutive pieces through update(),
+// and digest() returns the hash of their concatenation
+class _xxh64_stream {
+    public:
+    explicit _xxh64_stream(std::uint64_t seed = 0) noexcept
+        : seed_(seed),
+          v_{seed + _xxh64::prime1 + _xxh64::prime2, seed + _xxh64::prime2,
+             seed, seed - _xxh64::prime1} {}
+
+    void update(const void* data, std::size_t size) noexcept {
+        if (size == 0) {
+            return;
+        }
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        const unsigned char* const end = p + size;
+        total_ += size;
+        if (buffered_ + size < 32) {
+            std::memcpy(buffer_ + buffered_, p, size);
+            buffered_ += size;
+            return;
+        }
+        if (buffered_ != 0) {
+            const std::size_t fill = 32 - buffered_;
+            std::memcpy(buffer_ + buffered_, p, fill);
+            _stripe(buffer_);
+            p += fill;
+            buffered_ = 0;
+        }
+        for (; p + 32 <= end; p += 32) {
+            _stripe(p);
+        }
+        buffered_ = static_cast<std::size_t>(end - p);
+        std::memcpy(buffer_, p, buffered_);
+    }
+
+    std::uint64_t digest() const noexcept {
+        std::uint64_t h;
+        if (total_ >= 32) {
+            h = _xxh64::rotl(v_[0], 1) + _xxh64::rotl(v_[1], 7)
+                + _xxh64::rotl(v_[2], 12) + _xxh64::rotl(v_[3], 18);
+            for (std::uint64_t v : v_) {
+                h = _xxh64::merge(h, v);
+            }
+        } else {
+            h = seed_ + _xxh64::prime5;
+        }
+        h += total_;
+        const unsigned char* p = buffer_;
+        const unsigned char* const end = buffer_ + buffered_;
+        for (; p + 8 <= end; p += 8) {
+            h ^= _xxh64::round(0, _xxh64::read64(p));
+            h = _xxh64::rotl(h, 27) * _xxh64::prime1 + _xxh64::prime4;
+        }
+        if (p + 4 <= end) {
+            h ^= static_cast<std::uint64_t>(_xxh64::read32(p)) * _xxh64::prime1;
+            h = _xxh64::rotl(h, 23) * _xxh64::prime2 + _xxh64::prime3;
+            p += 4;
+        }
+        for (; p < end; ++p) {
+            h ^= static_cast<std::uint64_t>(*p) * _xxh64::prime5;
+            h = _xxh64::rotl(h, 11) * _xxh64::prime1;
+        }
+        h ^= h >> 33;
+        h *= _xxh64::prime2;
+        h ^= h >> 29;
+        h *= _xxh64::prime3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    private:
+    void _stripe(const unsigned char* p) noexcept {
+        v_[0] = _xxh64::round(v_[0], _xxh64::read64(p));
+        v_[1] = _xxh64::round(v_[1], _xxh64::read64(p + 8));
+        v_[2] = _xxh64::round(v_[2], _xxh64::read64(p + 16));
+        v_[3] = _xxh64::round(v_[3], _xxh64::read64(p + 24));
+    }
+
+    std::uint64_t seed_;
+    std::uint64_t v_[4];
+    std::uint64_t total_ = 0;
+    unsigned char buffer_[32];
+    std::size_t buffered_ = 0;
+};
+
+inline std::uint64_t xxh64(const void* data, std::size_t size, std::uint64_t seed = 0) noexcept {
+    _xxh64_stream stream(seed);
+    stream.update(data, size);
+    return stream.digest();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- BIT FORMAT: HEADER ----------------------------- //
+template <class T>
+inline void _store_le(unsigned char* p, T value) noexcept {
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        p[i] = static_cast<unsigned char>(static_cast<std::uint64_t>(value) >> (8 * i));
+    }
+}
+
+template <class T>
+inline T _load_le(const unsigned char* p) noexcept {
+    std::uint64_t value = 0;
+    for (std::size_t i = sizeof(T); i-- > 0;) {
+        value = (value << 8) | p[i];
+    }
+    return static_cast<T>(value);
+}
+
+inline std::array<unsigned char, bit_format::header_size>
+_encode_header(const bit_format_header& header) noexcept {
+    std::array<unsigned char, bit_format::header_size> bytes{};
+    std::memcpy(bytes.data(), bit_format::magic.data(), bit_format::magic.size());
+    _store_le(bytes.data() + 8, header.version);
+    bytes[10] = header.word_bits;
+    bytes[11] = header.endianness;
+    _store_le(bytes.data() + 12, header.header_size);
+    _store_le(bytes.data() + 16, header.bit_length);
+    _store_le(bytes.data() + 24, header.payload_bytes);
+    _store_le(bytes.data() + 32, header.payload_checksum);
+    _store_le(bytes.data() + 40, xxh64(bytes.data(), 40));
+    return bytes;
+}
+
+// Checks everything that does not depend on the payload
+inline bit_format_header _decode_header(const unsigned char* bytes) {
+    if (std::memcmp(bytes, bit_format::magic.data(), bit_format::magic.size()) != 0) {
+        throw format_error("bit format: bad magic");
+    }
+    if (_load_le<std::uint64_t>(bytes + 40) != xxh64(bytes, 40)) {
+        throw format_error("bit format: header checksum mismatch");
+    }
+    // The reserved bytes are not covered by the checksum
+    for (std::size_t i = 48; i < bit_format::header_size; ++i) {
+        if (bytes[i] != 0) {
+            throw format_error("bit format: non-zero reserved bytes");
+        }
+    }
+    bit_format_header header;
+    header.version = _load_le<std::uint16_t>(bytes + 8);
+    header.word_bits = bytes[10];
+    header.endianness = bytes[11];
+    header.header_size = _load_le<std::uint32_t>(bytes + 12);
+    header.bit_length = _load_le<std::uint64_t>(bytes + 16);
+    header.payload_bytes = _load_le<std::uint64_t>(bytes + 24);
+    header.payload_checksum = _load_le<std::uint64_t>(bytes + 32);
+    if (header.version != bit_format::version) {
+        throw format_error("bit format: unsupported version " + std::to_string(header.version));
+    }
+    if (header.header_size < bit_format::header_size || header.header_size % 64 != 0) {
+        throw format_error("bit format: bad header size");
+    }
+    if (header.endianness != bit_format::little_endian && header.endianness != bit_format::big_endian) {
+        throw format_error("bit format: bad byte order");
+    }
+    const std::uint64_t word_bytes = header.word_bits / 8;
+    if (header.word_bits == 0 || header.word_bits % 8 != 0
+            || header.payload_bytes % word_bytes != 0
+            || header.payload_bytes / word_bytes
+                != (header.bit_length + header.word_bits - 1) / header.word_bits) {
+        throw format_error("bit format: inconsistent lengths");
+    }
+    return header;
+}
+
+template <class WordType>
+inline void _check_word_type(const bit_format_header& header) {
+    if (header.word_bits != binary_digits<WordType>::value) {
+        throw format_error("bit format: stored with " + std::to_string(header.word_bits)
+                + "-bit words, read with " + std::to_string(binary_digits<WordType>::value));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ BIT FORMAT: OPERATIONS -------------------------- //
+// Writes the header and the words of bv
+template <class WordType, class Allocator>
+void save(std::ostream& os, const bit_vector<WordType, Allocator>& bv) {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    const std::size_t num_words = (bv.size() + digits - 1) / digits;
+    const WordType* words = bv.data();
+    // The last word is written with the bits past the end cleared
+    WordType last = 0;
+    if (num_words != 0) {
+        const std::size_t tail = bv.size() % digits;
+        last = tail == 0 ? words[num_words - 1]
+            : static_cast<WordType>(words[num_words - 1] & ((WordType(1) << tail) - 1));
+    }
+    const std::size_t full_bytes = num_words == 0 ? 0 : (num_words - 1) * sizeof(WordType);
+
+    bit_format_header header;
+    header.word_bits = static_cast<std::uint8_t>(digits);
+    header.bit_length = bv.size();
+    header.payload_bytes = num_words * sizeof(WordType);
+    _xxh64_stream checksum;
+    checksum.update(words, full_bytes);
+    if (num_words != 0) {
+        checksum.update(&last, sizeof(WordType));
+    }
+    header.payload_checksum = checksum.digest();
+
+    const auto bytes = _encode_header(header);
+    os.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    os.write(reinterpret_cast<const char*>(words), full_bytes);
+    if (num_words != 0) {
+        os.write(reinterpret_cast<const char*>(&last), sizeof(WordType));
+    }
+    if (!os) {
+        throw format_error("bit format: write failed");
+    }
+}
+
+// Reads a vector written by save, reading the words straight into its
+// storage. Words stored in the other byte order are swapped.
+template <class WordType, class Allocator = std::allocator<WordType>>
+bit_vector<WordType, Allocator> load(std::istream& is) {
+    std::array<unsigned char, bit_format::header_size> bytes;
+    if (!is.read(reinterpret_cast<char*>(bytes.data()), bytes.size())) {
+        throw format_error("bit format: truncated header");
+    }
+    const bit_format_header header = _decode_header(bytes.data());
+    _check_word_type<WordType>(header);
+    const std::streamsize padding = header.header_size - bit_format::header_size;
+    if (is.ignore(padding).gcount() != padding) {
+        throw format_error("bit format: truncated header");
+    }
+
+    bit_vector<WordType, Allocator> bv(header.bit_length);
+    if (header.payload_bytes != 0) {
+        if (!is.read(reinterpret_cast<char*>(bv.data()), header.payload_bytes)) {
+            throw format_error("bit format: truncated payload");
+        }
+        if (xxh64(bv.data(), header.payload_bytes) != header.payload_checksum) {
+            throw format_error("bit format: payload checksum mismatch");
+        }
+        if (header.endianness != bit_format::native_endian) {
+            WordType* words = bv.data();
+            for (std::size_t i = 0; i < header.payload_bytes / sizeof(WordType); ++i) {
+                words[i] = _byteswap(words[i]);
+            }
+        }
+    }
+    return bv;
+}
+
+// Returns a read-only view of the words of a serialized vector held in
+// memory, typically a mapped file, without copying them. Only the header is
+// checked unless verify_checksum is set, so that this takes constant time.
+// The words must be in the byte order of the machine, and aligned for
+// WordType.
+template <class WordType>
+bit_span<const WordType> view(
+        const void* buffer,
+        std::size_t size,
+        bool verify_checksum = false) {
+    if (size < bit_format::header_size) {
+        throw format_error("bit format: truncated header");
+    }
+    const unsigned char* bytes = static_cast<const unsigned char*>(buffer);
+    const bit_format_header header = _decode_header(bytes);
+    _check_word_type<WordType>(header);
+    if (header.endianness != bit_format::native_endian) {
+        throw format_error("bit format: words are in the other byte order");
+    }
+    if (size - header.header_size < header.payload_bytes || size < header.header_size) {
+        throw format_error("bit format: truncated payload");
+    }
+    const unsigned char* payload = bytes + header.header_size;
+    if (reinterpret_cast<std::uintptr_t>(payload) % alignof(WordType) != 0) {
+        throw format_error("bit format: misaligned payload");
+    }
+    if (verify_checksum && xxh64(payload, header.payload_bytes) != header.payload_checksum) {
+        throw format_error("bit format: payload checksum mismatch");
+    }
+    return bit_span<const WordType>(
+            reinterpret_cast<const WordType*>(payload), header.bit_length);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _SERIALIZATION_HPP_INCLUDED
+// ========================================================================== //
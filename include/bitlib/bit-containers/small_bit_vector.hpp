@@ -0,0 +1,797 @@
+// ============================ SMALL BIT VECTOR ============================ //
+// Project:     The Experimental Bit Algorithms Library
+// \file        small_bit_vector.hpp
+// Description: A bit_vector which stores its first words inline
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SMALL_BIT_VECTOR_HPP_INCLUDED
+#define _SMALL_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* *************************** SMALL BIT VECTOR ***************************** */
+//! A bit-vector with the interface of bit_vector, which keeps up to
+//! InlineWords words in the object itself and only allocates once it grows
+//! past them. By default the inline buffer holds 256 bits.
+template<
+    class WordType,
+    std::size_t InlineWords = (256 + binary_digits<WordType>::value - 1)
+        / binary_digits<WordType>::value,
+    class Allocator = std::allocator<WordType>>
+class small_bit_vector {
+    static_assert(InlineWords > 0, "small_bit_vector needs an inline buffer");
+
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+        static constexpr std::size_t digits = binary_digits<WordType>::value;
+
+        // Points either to inline_words_ or to a heap buffer of capacity_
+        // words. The words past word_count(length_) are unspecified.
+        WordType* data_;
+        std::size_t capacity_ = InlineWords;
+        std::size_t length_ = 0;
+        Allocator alloc_;
+        WordType inline_words_[InlineWords] = {};
+
+        // @brief Get the number of words needed to represent num_bits bits
+        static constexpr std::size_t word_count(std::size_t num_bits) {
+            return (num_bits + digits - 1) / digits;
+        }
+        constexpr bool on_heap() const noexcept {return data_ != inline_words_;}
+        // Moves the words to a buffer of exactly new_cap words, which is
+        // inline whenever they fit
+        constexpr void reallocate(std::size_t new_cap);
+        // Makes room for at least num_words words, growing geometrically
+        constexpr void grow_to(std::size_t num_words);
+        // Appends count bits of unspecified value, zeroing the new words
+        constexpr void extend(std::size_t count);
+        constexpr void release() noexcept;
+
+        // Iterator pair constructor specializations
+        // Passing in iterator over bool
+        template<class RandomAccessIt>
+        typename std::enable_if<
+            std::is_same<
+                typename std::iterator_traits<RandomAccessIt>::value_type,
+                bool
+            >::value
+        >::type
+        constexpr range_constructor(RandomAccessIt first, RandomAccessIt last);
+
+        // Passing in iterator over WordType constructs via whole words
+        template<class RandomAccessIt>
+        typename std::enable_if<
+            std::is_same<
+                typename std::iterator_traits<RandomAccessIt>::value_type,
+                WordType
+            >::value
+        >::type
+        constexpr range_constructor(RandomAccessIt first, RandomAccessIt last);
+
+    public:
+        /*
+         * Types and typedefs
+         */
+        using value_type = bit_value;
+        using base_type = WordType;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = bit_reference<WordType>;
+        using const_reference = const reference;
+        using pointer = bit_pointer<WordType>;
+        using iterator = bit_iterator<WordType*>;
+        using const_iterator = bit_iterator<const WordType*>;
+        static constexpr size_type inline_capacity = InlineWords * digits;
+
+
+        /*
+         * Constructors, copies and moves...
+         */
+        constexpr small_bit_vector() noexcept(noexcept(Allocator()));
+        constexpr explicit small_bit_vector(const Allocator& alloc) noexcept;
+        constexpr small_bit_vector(
+                size_type count,
+                value_type bit_val,
+                const Allocator& alloc=Allocator());
+        constexpr explicit small_bit_vector(
+                size_type count,
+                const Allocator& alloc=Allocator());
+        template<class RandomAccessIt>
+        constexpr small_bit_vector(
+                bit_iterator<RandomAccessIt> first,
+                bit_iterator<RandomAccessIt> last,
+                const Allocator& alloc=Allocator());
+        template<class RandomAccessIt>
+        constexpr small_bit_vector(
+                RandomAccessIt first,
+                RandomAccessIt last,
+                const Allocator& alloc=Allocator());
+        constexpr small_bit_vector(const small_bit_vector& other);
+        constexpr small_bit_vector(const small_bit_vector& other, const Allocator& alloc);
+        constexpr small_bit_vector(small_bit_vector&& other) noexcept;
+        constexpr small_bit_vector(std::initializer_list<bit_value> init, const Allocator& alloc=Allocator());
+        constexpr small_bit_vector(std::initializer_list<bool> init, const Allocator& alloc=Allocator());
+        constexpr small_bit_vector(std::initializer_list<WordType> init, const Allocator& alloc=Allocator());
+        constexpr small_bit_vector(std::string_view s);
+
+#if __cplusplus == 201703L
+        ~small_bit_vector();
+#else
+        constexpr ~small_bit_vector();
+#endif
+
+
+        /*
+         * Assignment
+         */
+        constexpr small_bit_vector& operator=(const small_bit_vector& other);
+        // Copies the words instead of stealing the buffer when the
+        // allocators differ and do not propagate, which may allocate
+        constexpr small_bit_vector& operator=(small_bit_vector&& other) noexcept(
+                alloc_traits::propagate_on_container_move_assignment::value
+                || alloc_traits::is_always_equal::value);
+        constexpr void swap(small_bit_vector& other) noexcept;
+
+
+        /*
+         * Element Access
+         */
+        constexpr reference operator[](size_type pos);
+        constexpr reference operator[](size_type pos) const;
+        constexpr reference at(size_type pos);
+        constexpr const_reference at(size_type pos) const;
+        constexpr reference front();
+        constexpr const_reference front() const;
+        constexpr reference back();
+        constexpr const_reference back() const;
+        constexpr WordType* data() noexcept;
+        constexpr const WordType* data() const noexcept;
+
+
+        /*
+         * Iterators
+         */
+        constexpr iterator begin() noexcept;
+        constexpr iterator end() noexcept;
+        constexpr const_iterator begin() const noexcept;
+        constexpr const_iterator end() const noexcept;
+        constexpr const_iterator cbegin() const noexcept;
+        constexpr const_iterator cend() const noexcept;
+
+
+        /*
+         * Capacity
+         */
+        constexpr bool empty() const noexcept;
+        constexpr size_type size() const noexcept;
+        constexpr size_type max_size() const noexcept;
+        constexpr void reserve(size_type new_cap);
+        constexpr size_type capacity() const noexcept;
+        constexpr void shrink_to_fit();
+        // Whether the words are currently stored in the object itself
+        constexpr bool is_inline() const noexcept {return !on_heap();}
+
+
+        /*
+         * Modifiers
+         */
+        constexpr void clear() noexcept;
+        constexpr iterator insert(const_iterator pos, const value_type& value);
+        constexpr iterator insert(const_iterator pos, size_type count, const value_type& value);
+        constexpr iterator insert(const_iterator pos, iterator first, iterator last);
+        constexpr iterator erase(iterator pos);
+        constexpr iterator erase(iterator first, iterator last);
+        constexpr void push_back(const value_type& value);
+        constexpr void pop_back();
+        constexpr void resize(size_type count);
+        constexpr void resize(size_type count, const value_type& value);
+
+
+        /*
+         * Helper functions
+         */
+        constexpr std::string debug_string();
+};
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void swap(
+        small_bit_vector<WordType, InlineWords, Allocator>& lhs,
+        small_bit_vector<WordType, InlineWords, Allocator>& rhs) noexcept {
+    lhs.swap(rhs);
+}
+/* ************************************************************************** */
+
+
+
+// ---------------------- SMALL BIT VECTOR: STORAGE ------------------------- //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::reallocate(
+        std::size_t new_cap) {
+    const std::size_t used = word_count(length_);
+    WordType* new_data = inline_words_;
+    if (new_cap > InlineWords) {
+        new_data = alloc_traits::allocate(alloc_, new_cap);
+    } else {
+        new_cap = InlineWords;
+    }
+    if (new_data != data_) {
+        std::copy(data_, data_ + used, new_data);
+        release();
+        data_ = new_data;
+    }
+    capacity_ = new_cap;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::grow_to(
+        std::size_t num_words) {
+    if (num_words > capacity_) {
+        reallocate(std::max(num_words, 2 * capacity_));
+    }
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::extend(
+        std::size_t count) {
+    const std::size_t old_words = word_count(length_);
+    const std::size_t new_words = word_count(length_ + count);
+    grow_to(new_words);
+    std::fill(data_ + old_words, data_ + new_words, WordType(0));
+    length_ += count;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::release() noexcept {
+    if (on_heap()) {
+        alloc_traits::deallocate(alloc_, data_, capacity_);
+        data_ = inline_words_;
+        capacity_ = InlineWords;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: LIFECYCLE ----------------------- //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector()
+    noexcept(noexcept(Allocator()))
+    : data_(inline_words_), alloc_() {}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        const Allocator& alloc) noexcept
+    : data_(inline_words_), alloc_(alloc) {}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        size_type count,
+        value_type bit_val,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    resize(count, bit_val);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        size_type count,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    extend(count);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+template<class RandomAccessIt>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        bit_iterator<RandomAccessIt> first,
+        bit_iterator<RandomAccessIt> last,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    extend(distance(first, last));
+    copy(first, last, begin());
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+template<class RandomAccessIt>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        RandomAccessIt first,
+        RandomAccessIt last,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    range_constructor(first, last);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        const small_bit_vector& other)
+    : small_bit_vector(other, alloc_traits::select_on_container_copy_construction(other.alloc_)) {}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        const small_bit_vector& other,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    grow_to(word_count(other.length_));
+    std::copy(other.data_, other.data_ + word_count(other.length_), data_);
+    length_ = other.length_;
+}
+
+// A heap buffer is stolen; inline words are copied
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        small_bit_vector&& other) noexcept
+    : small_bit_vector(std::move(other.alloc_)) {
+    if (other.on_heap()) {
+        data_ = other.data_;
+        capacity_ = other.capacity_;
+        other.data_ = other.inline_words_;
+        other.capacity_ = InlineWords;
+    } else {
+        std::copy(other.data_, other.data_ + word_count(other.length_), data_);
+    }
+    length_ = other.length_;
+    other.length_ = 0;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        std::initializer_list<bit_value> init,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    extend(init.size());
+    std::copy(init.begin(), init.end(), begin());
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        std::initializer_list<bool> init,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    range_constructor(init.begin(), init.end());
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        std::initializer_list<WordType> init,
+        const Allocator& alloc)
+    : small_bit_vector(alloc) {
+    range_constructor(init.begin(), init.end());
+}
+
+// Skip all characters that are not 0/1. This allows punctuation/spacing for byte/word boundaries
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::small_bit_vector(
+        std::string_view s)
+    : small_bit_vector() {
+    extend(std::count(s.begin(), s.end(), '0') + std::count(s.begin(), s.end(), '1'));
+    size_type i = 0;
+    for (char c : s) {
+        if (c == '0') {
+            begin()[i++] = bit0;
+        } else if (c == '1') {
+            begin()[i++] = bit1;
+        }
+    }
+}
+
+// Iterator pair constructor specializations
+// Passing in iterator over bool
+template<class WordType, std::size_t InlineWords, class Allocator>
+template<class RandomAccessIt>
+typename std::enable_if<
+    std::is_same<
+        typename std::iterator_traits<RandomAccessIt>::value_type,
+        bool
+    >::value
+>::type
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::range_constructor(
+        RandomAccessIt first,
+        RandomAccessIt last) {
+    extend(std::distance(first, last));
+    std::transform(
+            first,
+            last,
+            begin(),
+            [](bool b) {return static_cast<bit_value>(b);}
+    );
+}
+
+// Passing in iterator over WordType constructs via whole words
+template<class WordType, std::size_t InlineWords, class Allocator>
+template<class RandomAccessIt>
+typename std::enable_if<
+    std::is_same<
+        typename std::iterator_traits<RandomAccessIt>::value_type,
+        WordType
+    >::value
+>::type
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::range_constructor(
+        RandomAccessIt first,
+        RandomAccessIt last) {
+    const auto num_words = std::distance(first, last);
+    grow_to(num_words);
+    std::copy(first, last, data_);
+    length_ = digits * num_words;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+#if __cplusplus == 201703L
+small_bit_vector<WordType, InlineWords, Allocator>::~small_bit_vector() {
+#else
+constexpr small_bit_vector<WordType, InlineWords, Allocator>::~small_bit_vector() {
+#endif
+    release();
+    length_ = 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: ASSIGNMENT ---------------------- //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>&
+small_bit_vector<WordType, InlineWords, Allocator>::operator=(
+        const small_bit_vector& other) {
+    if (this != &other) {
+        const std::size_t num_words = word_count(other.length_);
+        if (num_words > capacity_) {
+            release();
+            length_ = 0;
+            grow_to(num_words);
+        }
+        std::copy(other.data_, other.data_ + num_words, data_);
+        length_ = other.length_;
+    }
+    return *this;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr small_bit_vector<WordType, InlineWords, Allocator>&
+small_bit_vector<WordType, InlineWords, Allocator>::operator=(
+        small_bit_vector&& other) noexcept(
+                alloc_traits::propagate_on_container_move_assignment::value
+                || alloc_traits::is_always_equal::value) {
+    constexpr bool propagate = alloc_traits::propagate_on_container_move_assignment::value;
+    if (this != &other) {
+        // other's heap buffer can only be freed through an equal allocator
+        if (!propagate && !(alloc_ == other.alloc_)) {
+            *this = static_cast<const small_bit_vector&>(other);
+            other.length_ = 0;
+            return *this;
+        }
+        release();
+        if constexpr (propagate) {
+            alloc_ = std::move(other.alloc_);
+        }
+        if (other.on_heap()) {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_words_;
+            other.capacity_ = InlineWords;
+        } else {
+            std::copy(other.data_, other.data_ + word_count(other.length_), data_);
+        }
+        length_ = other.length_;
+        other.length_ = 0;
+    }
+    return *this;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::swap(
+        small_bit_vector& other) noexcept {
+    small_bit_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ SMALL BIT VECTOR: ACCESS ------------------------ //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::reference
+small_bit_vector<WordType, InlineWords, Allocator>::operator[](size_type pos) {
+    return begin()[pos];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::reference
+small_bit_vector<WordType, InlineWords, Allocator>::operator[](size_type pos) const {
+    return iterator(data_)[pos];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::reference
+small_bit_vector<WordType, InlineWords, Allocator>::at(size_type pos) {
+    if (pos < length_) {
+        return begin()[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_reference
+small_bit_vector<WordType, InlineWords, Allocator>::at(size_type pos) const {
+    if (pos < length_) {
+        return (*this)[pos];
+    } else {
+        throw std::out_of_range("Position is out of range");
+    }
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::reference
+small_bit_vector<WordType, InlineWords, Allocator>::front() {
+    return begin()[0];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_reference
+small_bit_vector<WordType, InlineWords, Allocator>::front() const {
+    return (*this)[0];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::reference
+small_bit_vector<WordType, InlineWords, Allocator>::back() {
+    return begin()[length_ - 1];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_reference
+small_bit_vector<WordType, InlineWords, Allocator>::back() const {
+    return (*this)[length_ - 1];
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr WordType*
+small_bit_vector<WordType, InlineWords, Allocator>::data() noexcept {
+    return data_;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr const WordType*
+small_bit_vector<WordType, InlineWords, Allocator>::data() const noexcept {
+    return data_;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: ITERATORS ----------------------- //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::begin() noexcept {
+    return iterator(data_);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::end() noexcept {
+    return begin() + length_;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_iterator
+small_bit_vector<WordType, InlineWords, Allocator>::begin() const noexcept {
+    return const_iterator(data_);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_iterator
+small_bit_vector<WordType, InlineWords, Allocator>::end() const noexcept {
+    return begin() + length_;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_iterator
+small_bit_vector<WordType, InlineWords, Allocator>::cbegin() const noexcept {
+    return begin();
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::const_iterator
+small_bit_vector<WordType, InlineWords, Allocator>::cend() const noexcept {
+    return end();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: CAPACITY ------------------------ //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr bool small_bit_vector<WordType, InlineWords, Allocator>::empty() const noexcept {
+    return length_ == 0;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::size_type
+small_bit_vector<WordType, InlineWords, Allocator>::size() const noexcept {
+    return length_;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::size_type
+small_bit_vector<WordType, InlineWords, Allocator>::max_size() const noexcept {
+    return alloc_traits::max_size(alloc_) * digits;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::reserve(size_type new_cap) {
+    if (word_count(new_cap) > capacity_) {
+        reallocate(word_count(new_cap));
+    }
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::size_type
+small_bit_vector<WordType, InlineWords, Allocator>::capacity() const noexcept {
+    return capacity_ * digits;
+}
+
+// Moves the words back inline when they fit again
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::shrink_to_fit() {
+    if (on_heap() && word_count(length_) < capacity_) {
+        reallocate(word_count(length_));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: MODIFYING ----------------------- //
+// Keeps the buffer, as std::vector does
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::clear() noexcept {
+    length_ = 0;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::insert(
+        const_iterator pos,
+        const value_type& value) {
+    return insert(pos, 1, value);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::insert(
+        const_iterator pos,
+        size_type count,
+        const value_type& value) {
+    const auto d = distance(cbegin(), pos);
+    if (count == 0) {
+        return begin() + d;
+    }
+    extend(count);
+    shift_right(begin() + d, end(), count);
+    fill(begin() + d, begin() + d + count, value);
+    return begin() + d;
+}
+
+// [first, last) must not be a range of this vector
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::insert(
+        const_iterator pos,
+        iterator first,
+        iterator last) {
+    const auto d = distance(cbegin(), pos);
+    const size_type count = distance(first, last);
+    if (count == 0) {
+        return begin() + d;
+    }
+    extend(count);
+    shift_right(begin() + d, end(), count);
+    copy(first, last, begin() + d);
+    return begin() + d;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::erase(iterator pos) {
+    return erase(pos, pos + 1);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr typename small_bit_vector<WordType, InlineWords, Allocator>::iterator
+small_bit_vector<WordType, InlineWords, Allocator>::erase(iterator first, iterator last) {
+    const auto count = distance(first, last);
+    if (count == 0) {
+        return last;
+    }
+    shift_left(first, end(), count);
+    length_ -= count;
+    return first;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::push_back(
+        const value_type& value) {
+    if (length_ % digits == 0) {
+        grow_to(length_ / digits + 1);
+    }
+    begin()[length_] = value;
+    length_ += 1;
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::pop_back() {
+    length_ -= 1;
+}
+
+// The new bits are 0
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::resize(size_type count) {
+    resize(count, bit0);
+}
+
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr void small_bit_vector<WordType, InlineWords, Allocator>::resize(
+        size_type count,
+        const value_type& value) {
+    const auto old_length = length_;
+    if (count > old_length) {
+        extend(count - old_length);
+        fill(begin() + old_length, end(), value);
+    } else {
+        length_ = count;
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- SMALL BIT VECTOR: DEBUGGING ----------------------- //
+template<class WordType, std::size_t InlineWords, class Allocator>
+constexpr std::string small_bit_vector<WordType, InlineWords, Allocator>::debug_string() {
+    std::string ret = "";
+    size_type position = 0;
+    for (iterator it = begin(); it != end(); ++it) {
+        if (position % digits == 0 && position != 0) {
+            ret += " ";
+        } else if (position % 8 == 0 && position != 0) {
+            ret += '.';
+        }
+        ret += *it == bit1 ? '1' : '0';
+        ++position;
+    }
+    return ret;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _SMALL_BIT_VECTOR_HPP_INCLUDED
+// ========================================================================== //
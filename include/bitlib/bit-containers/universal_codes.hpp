@@ -0,0 +1,222 @@
+// ============================ UNIVERSAL CODES ============================= //
+// Project:     The Experimental Bit Algorithms Library
+// \file        universal_codes.hpp
+// Description: Elias gamma and delta, Golomb-Rice and exp-Golomb codes
+// Contributor: Bryce Kille
+// License:     BSD 3-Clause License
+// ========================================================================== //
+#ifndef _UNIVERSAL_CODES_HPP_INCLUDED
+#define _UNIVERSAL_CODES_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ================================ PREAMBLE ================================ //
+// C++ standard library
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+// Project sources
+#include "bitlib/bit-iterator/bit.hpp"
+#include "bit_stream.hpp"
+// Third-party libraries
+// Miscellaneous
+namespace bit {
+// ========================================================================== //
+
+
+
+/* **************************** UNIVERSAL CODES ***************************** */
+// Each code is written with a bit_writer and read with a bit_reader. The
+// unary prefixes are runs of zeros ended by a one, which the reader counts
+// a whole word at a time. As with every field of bit_writer, the binary
+// part that follows a prefix is stored least significant bit first, so the
+// codes have their usual lengths but not their textbook bit order.
+
+// Elias gamma code of values >= 1: floor(log2(x)) in unary, then the bits
+// of x below its leading one
+struct gamma_code {
+    static std::size_t length(std::uint64_t value) noexcept;
+    template <class WordType, class Allocator>
+    void encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const;
+    template <class WordType>
+    std::uint64_t decode(bit_reader<WordType>& in) const;
+};
+
+// Elias delta code of values >= 1: floor(log2(x)) + 1 in gamma code, then
+// the bits of x below its leading one
+struct delta_code {
+    static std::size_t length(std::uint64_t value) noexcept;
+    template <class WordType, class Allocator>
+    void encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const;
+    template <class WordType>
+    std::uint64_t decode(bit_reader<WordType>& in) const;
+};
+
+// Golomb-Rice code with parameter k < 64: x >> k in unary, then the k low
+// bits of x
+struct rice_code {
+    unsigned int k = 0;
+
+    std::size_t length(std::uint64_t value) const noexcept;
+    template <class WordType, class Allocator>
+    void encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const;
+    template <class WordType>
+    std::uint64_t decode(bit_reader<WordType>& in) const;
+};
+
+// Exp-Golomb code of order k < 64: the gamma code of x + 2^k without its k
+// leading zeros. Values must be below 2^64 - 2^k.
+struct exp_golomb_code {
+    unsigned int k = 0;
+
+    std::size_t length(std::uint64_t value) const noexcept;
+    template <class WordType, class Allocator>
+    void encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const;
+    template <class WordType>
+    std::uint64_t decode(bit_reader<WordType>& in) const;
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- UNIVERSAL CODES: DETAILS ----------------------- //
+// Position of the leading one of a non zero value
+inline unsigned int _floor_log2(std::uint64_t value) noexcept {
+    return 63 - static_cast<unsigned int>(_lzcnt(value));
+}
+
+// A value with its leading one at position n, and the n bits below it
+template <class WordType>
+inline std::uint64_t _read_leading_one(bit_reader<WordType>& in, std::size_t n) {
+    if (n > 63) {
+        throw std::out_of_range("universal code: value out of range");
+    }
+    const unsigned int bits = static_cast<unsigned int>(n);
+    return (std::uint64_t(1) << bits) | in.get(bits);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ UNIVERSAL CODES: GAMMA -------------------------- //
+inline std::size_t gamma_code::length(std::uint64_t value) noexcept {
+    assert(value != 0);
+    return 2 * _floor_log2(value) + 1;
+}
+
+template <class WordType, class Allocator>
+inline void gamma_code::encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const {
+    assert(value != 0);
+    const unsigned int n = _floor_log2(value);
+    out.put_unary(n);
+    out.put(value, n);
+}
+
+template <class WordType>
+inline std::uint64_t gamma_code::decode(bit_reader<WordType>& in) const {
+    return _read_leading_one(in, in.get_unary());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ UNIVERSAL CODES: DELTA -------------------------- //
+inline std::size_t delta_code::length(std::uint64_t value) noexcept {
+    assert(value != 0);
+    const unsigned int n = _floor_log2(value);
+    return gamma_code::length(n + 1) + n;
+}
+
+template <class WordType, class Allocator>
+inline void delta_code::encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const {
+    assert(value != 0);
+    const unsigned int n = _floor_log2(value);
+    gamma_code().encode(out, n + 1);
+    out.put(value, n);
+}
+
+template <class WordType>
+inline std::uint64_t delta_code::decode(bit_reader<WordType>& in) const {
+    return _read_leading_one(in, gamma_code().decode(in) - 1);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- UNIVERSAL CODES: RICE -------------------------- //
+inline std::size_t rice_code::length(std::uint64_t value) const noexcept {
+    assert(k < 64);
+    return (value >> k) + 1 + k;
+}
+
+template <class WordType, class Allocator>
+inline void rice_code::encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const {
+    assert(k < 64);
+    out.put_unary(value >> k);
+    out.put(value, k);
+}
+
+template <class WordType>
+inline std::uint64_t rice_code::decode(bit_reader<WordType>& in) const {
+    const std::uint64_t quotient = in.get_unary();
+    if (k != 0 && (quotient >> (64 - k)) != 0) {
+        throw std::out_of_range("universal code: value out of range");
+    }
+    return (quotient << k) | in.get(k);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------- UNIVERSAL CODES: EXP-GOLOMB ----------------------- //
+inline std::size_t exp_golomb_code::length(std::uint64_t value) const noexcept {
+    assert(k < 64);
+    return 2 * _floor_log2(value + (std::uint64_t(1) << k)) + 1 - k;
+}
+
+template <class WordType, class Allocator>
+inline void exp_golomb_code::encode(bit_writer<WordType, Allocator>& out, std::uint64_t value) const {
+    assert(k < 64);
+    const std::uint64_t shifted = value + (std::uint64_t(1) << k);
+    assert(shifted > value);
+    const unsigned int n = _floor_log2(shifted);
+    out.put_unary(n - k);
+    out.put(shifted, n);
+}
+
+template <class WordType>
+inline std::uint64_t exp_golomb_code::decode(bit_reader<WordType>& in) const {
+    return _read_leading_one(in, in.get_unary() + k) - (std::uint64_t(1) << k);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- UNIVERSAL CODES: BULK -------------------------- //
+// Encodes the values of [first, last) one after the other
+template <class Code, class WordType, class Allocator, class InputIt>
+void encode(bit_writer<WordType, Allocator>& out, InputIt first, InputIt last, const Code& code = Code()) {
+    for (; first != last; ++first) {
+        code.encode(out, static_cast<std::uint64_t>(*first));
+    }
+}
+
+// Decodes n values into out, and returns the end of the output
+template <class Code, class WordType, class OutputIt>
+OutputIt decode_n(bit_reader<WordType>& in, OutputIt out, std::size_t n, const Code& code = Code()) {
+    for (; n != 0; --n) {
+        *out = code.decode(in);
+        ++out;
+    }
+    return out;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+#endif // _UNIVERSAL_CODES_HPP_INCLUDED
+// ========================================================================== //
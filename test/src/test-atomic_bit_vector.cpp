@@ -0,0 +1,163 @@
+// ========================= ATOMIC BIT VECTOR TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for atomic_bit_vector
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <atomic>
+#include <thread>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template<typename WordType>
+class AtomicVectorTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    const size_t digits = bit::binary_digits<WordType>::value;
+};
+TYPED_TEST_SUITE(AtomicVectorTest, BaseTypes);
+
+TYPED_TEST(AtomicVectorTest, PerBitOperations) {
+    using WordType = typename TestFixture::base_type;
+    const size_t size = 5*this->digits + 3;
+    bit::atomic_bit_vector<WordType> bv(size);
+    EXPECT_EQ(bv.size(), size);
+    for (size_t i = 0; i < size; i += 3) {
+        EXPECT_FALSE(bv.test_and_set(i));
+        EXPECT_TRUE(bv.test_and_set(i));
+        EXPECT_TRUE(bv.test(i));
+    }
+    for (size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(bv.test(i), i % 3 == 0);
+    }
+    for (size_t i = 0; i < size; i += 6) {
+        EXPECT_TRUE(bv.fetch_reset(i));
+        EXPECT_FALSE(bv.fetch_reset(i));
+    }
+    for (size_t i = 0; i < size; ++i) {
+        const bool old = bv.fetch_flip(i);
+        EXPECT_EQ(old, i % 3 == 0 && i % 6 != 0);
+        EXPECT_EQ(static_cast<bool>(bv[i]), !old);
+    }
+    bv[1] = bit::bit0;
+    EXPECT_FALSE(bv[1].load(std::memory_order_relaxed));
+    bv[1].store(bit::bit1, std::memory_order_release);
+    EXPECT_TRUE(bv[1].load(std::memory_order_acquire));
+}
+
+TYPED_TEST(AtomicVectorTest, PerWordOperations) {
+    using WordType = typename TestFixture::base_type;
+    bit::atomic_bit_vector<WordType> bv(4*this->digits);
+    EXPECT_EQ(bv.word_size(), 4u);
+    const WordType mask = static_cast<WordType>(0x5A);
+    EXPECT_EQ(bv.fetch_or_word(1, mask), 0);
+    EXPECT_EQ(bv.fetch_or_word(1, static_cast<WordType>(0x81)), mask);
+    EXPECT_EQ(bv.load_word(1), static_cast<WordType>(0xDB));
+    EXPECT_EQ(bv.fetch_and_word(1, static_cast<WordType>(0x0F)), static_cast<WordType>(0xDB));
+    EXPECT_EQ(bv.fetch_xor_word(1, static_cast<WordType>(0xFF)), static_cast<WordType>(0x0B));
+    EXPECT_EQ(bv.load_word(1), static_cast<WordType>(0xF4));
+    WordType expected = 0;
+    while (!bv.compare_exchange_word(2, expected, static_cast<WordType>(7))) {}
+    EXPECT_EQ(bv.load_word(2), 7);
+    expected = 0;
+    EXPECT_FALSE(bv.compare_exchange_word(2, expected, static_cast<WordType>(1)));
+    EXPECT_EQ(expected, 7);
+    bv.store_word(3, static_cast<WordType>(-1));
+    EXPECT_EQ(bit::count(bv.begin(), bv.end(), bit::bit1),
+            static_cast<std::ptrdiff_t>(this->digits + 5 + 3));
+    EXPECT_EQ(bit::find(bv.begin(), bv.end(), bit::bit1), bv.begin() + this->digits + 2);
+}
+
+TYPED_TEST(AtomicVectorTest, FillConstructor) {
+    using WordType = typename TestFixture::base_type;
+    const size_t size = 3*this->digits + 5;
+    bit::atomic_bit_vector<WordType> bv(size, bit::bit1);
+    EXPECT_EQ(bv.load_word(2), static_cast<WordType>(-1));
+    // The padding bits of the last word stay cleared
+    EXPECT_EQ(bv.load_word(3), static_cast<WordType>(0x1F));
+    EXPECT_EQ(bv.count(), size);
+    EXPECT_EQ(bit::count(bv.begin(), bv.end(), bit::bit1), static_cast<std::ptrdiff_t>(size));
+    // count() ignores padding bits set through the word interface
+    bv.fetch_or_word(3, static_cast<WordType>(-1));
+    bv.fetch_reset(0);
+    EXPECT_EQ(bv.count(), size - 1);
+}
+
+TYPED_TEST(AtomicVectorTest, ConcurrentTestAndSet) {
+    using WordType = typename TestFixture::base_type;
+    const size_t size = 1 << 14;
+    const unsigned int num_threads = 4;
+    bit::atomic_bit_vector<WordType> bv(size);
+    std::atomic<size_t> winners{0};
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    // count() may run alongside the writers, and only ever sees bits added
+    std::thread reader([&bv, &done, size]() {
+        size_t last = 0;
+        while (!done.load()) {
+            const size_t now = bv.count();
+            EXPECT_GE(now, last);
+            EXPECT_LE(now, size);
+            last = now;
+        }
+    });
+    // Every thread races for every bit; each bit must be won exactly once
+    for (unsigned int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&bv, &winners, size, t]() {
+            size_t won = 0;
+            for (size_t i = 0; i < size; ++i) {
+                const size_t pos = (i * 7 + t * 131) % size;
+                won += !bv.test_and_set(pos, std::memory_order_relaxed);
+            }
+            winners += won;
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    done = true;
+    reader.join();
+    EXPECT_EQ(winners.load(), size);
+    EXPECT_EQ(bv.count(), size);
+    EXPECT_EQ(bit::count(bv.begin(), bv.end(), bit::bit1), static_cast<std::ptrdiff_t>(size));
+}
+
+TYPED_TEST(AtomicVectorTest, ConcurrentFlipAndMerge) {
+    using WordType = typename TestFixture::base_type;
+    const size_t size = 64*this->digits;
+    const unsigned int num_threads = 4;
+    bit::atomic_bit_vector<WordType> bv(size);
+    std::vector<std::thread> threads;
+    // Each thread flips every non-lane bit twice and merges its own bit lane
+    // into every word, so only the merged lanes survive.
+    for (unsigned int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&bv, size, num_threads, t]() {
+            for (size_t i = 0; i < size; ++i) {
+                if (i % bit::binary_digits<WordType>::value >= num_threads) {
+                    bv.fetch_flip(i);
+                    bv.fetch_flip(i);
+                }
+            }
+            for (size_t w = 0; w < bv.word_size(); ++w) {
+                bv.fetch_or_word(w, static_cast<WordType>(1) << t);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (size_t w = 0; w < bv.word_size(); ++w) {
+        EXPECT_EQ(bv.load_word(w), static_cast<WordType>(0xF));
+    }
+}
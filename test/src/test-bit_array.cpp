@@ -0,0 +1,184 @@
+// ============================= BIT ARRAY TESTS ============================ //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the fixed-size bit_array container
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <bitset>
+#include <functional>
+#include <stdexcept>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Everything but the bit:: algorithms must be usable in constant expressions
+namespace {
+constexpr bit::bit_array<70, std::uint32_t> make_constexpr_array() {
+    bit::bit_array<70, std::uint32_t> arr("1011");
+    arr.set(69);
+    arr[40] = bit::bit1;
+    arr.flip(1);
+    return arr;
+}
+constexpr auto constexpr_array = make_constexpr_array();
+static_assert(constexpr_array.size() == 70);
+static_assert(constexpr_array.count() == 6);
+static_assert(constexpr_array.test(0) && constexpr_array.test(1) && !constexpr_array.test(4));
+static_assert(constexpr_array[69] == bit::bit1);
+static_assert((~constexpr_array).count() == 64);
+static_assert(bit::bit_array<70, std::uint32_t>(bit::bit1).all());
+static_assert(bit::bit_array<70, std::uint32_t>().none());
+static_assert((constexpr_array & ~constexpr_array).none());
+static_assert((constexpr_array | ~constexpr_array).all());
+static_assert((constexpr_array ^ constexpr_array) == bit::bit_array<70, std::uint32_t>());
+static_assert(bit::bit_array<8, std::uint8_t>{0xFF, 0xFF}.count() == 8);
+static_assert(bit::bit_array<0>().none() && bit::bit_array<0>().all());
+} // namespace
+
+// Every operation is checked against std::bitset, for sizes which are and
+// are not a multiple of the word size
+template<typename WordType>
+class BitArrayTest : public testing::Test {
+    protected:
+    static constexpr size_t digits = bit::binary_digits<WordType>::value;
+    static constexpr size_t size = 5*digits + 3;
+    using array_type = bit::bit_array<size, WordType>;
+    using full_array_type = bit::bit_array<4*digits, WordType>;
+    array_type random1;
+    array_type random2;
+    std::bitset<size> bitset1;
+    std::bitset<size> bitset2;
+
+    void SetUp() override {
+        for (size_t i = 0; i < size; ++i) {
+            bool b1 = generate_random_number(0, 1);
+            bool b2 = generate_random_number(0, 1);
+            random1[i] = bit::bit_value(b1);
+            random2[i] = bit::bit_value(b2);
+            bitset1[i] = b1;
+            bitset2[i] = b2;
+        }
+    }
+
+    template <class Array, std::size_t N>
+    static bool same(const Array& arr, const std::bitset<N>& bs) {
+        if (arr.size() != bs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            if ((arr[i] == bit::bit1) != bs[i]) {
+                return false;
+            }
+        }
+        return arr.count() == bs.count();
+    }
+};
+TYPED_TEST_SUITE(BitArrayTest, BaseTypes);
+
+TYPED_TEST(BitArrayTest, Construction) {
+    using array_type = typename TestFixture::array_type;
+    using WordType = TypeParam;
+    EXPECT_TRUE(this->same(array_type(), std::bitset<TestFixture::size>()));
+    EXPECT_TRUE(this->same(array_type(bit::bit1), std::bitset<TestFixture::size>().set()));
+    array_type from_words{WordType(0b101), WordType(-1)};
+    EXPECT_EQ(from_words.count(), 2u + TestFixture::digits);
+    EXPECT_EQ(from_words[2], bit::bit1);
+    EXPECT_EQ(from_words[TestFixture::digits], bit::bit1);
+    array_type from_string("01 1x1");
+    EXPECT_EQ(from_string.count(), 3u);
+    EXPECT_EQ(from_string[0], bit::bit0);
+    EXPECT_EQ(from_string[3], bit::bit1);
+    // Bits past the end are dropped, so that the padding stays zero
+    bit::bit_array<3, WordType> truncated{WordType(-1), WordType(-1)};
+    EXPECT_EQ(truncated.count(), 3u);
+    EXPECT_TRUE(truncated.all());
+}
+
+TYPED_TEST(BitArrayTest, Access) {
+    auto arr = this->random1;
+    EXPECT_TRUE(this->same(arr, this->bitset1));
+    EXPECT_EQ(arr.front(), arr[0]);
+    EXPECT_EQ(arr.back(), arr[TestFixture::size - 1]);
+    EXPECT_THROW(arr.at(TestFixture::size), std::out_of_range);
+    EXPECT_THROW(arr.test(TestFixture::size), std::out_of_range);
+    EXPECT_THROW(arr.set(TestFixture::size), std::out_of_range);
+    arr.at(3) = bit::bit1;
+    EXPECT_TRUE(arr.test(3));
+    arr.reset(3);
+    EXPECT_FALSE(arr.test(3));
+    arr.flip(3);
+    EXPECT_TRUE(arr.test(3));
+    arr.back() = bit::bit1;
+    EXPECT_EQ(arr[TestFixture::size - 1], bit::bit1);
+}
+
+TYPED_TEST(BitArrayTest, Operations) {
+    auto arr = this->random1;
+    auto bs = this->bitset1;
+    EXPECT_TRUE(this->same(arr.flip(), bs.flip()));
+    EXPECT_TRUE(this->same(~arr, ~bs));
+    EXPECT_TRUE(this->same(arr & this->random2, bs & this->bitset2));
+    EXPECT_TRUE(this->same(arr | this->random2, bs | this->bitset2));
+    EXPECT_TRUE(this->same(arr ^ this->random2, bs ^ this->bitset2));
+    EXPECT_TRUE(this->same(arr &= this->random2, bs &= this->bitset2));
+    EXPECT_TRUE(this->same(arr |= this->random1, bs |= this->bitset1));
+    EXPECT_TRUE(this->same(arr ^= this->random2, bs ^= this->bitset2));
+    EXPECT_TRUE(this->same(arr.set(), bs.set()));
+    EXPECT_TRUE(arr.all());
+    EXPECT_TRUE(arr.any());
+    arr[TestFixture::size - 1] = bit::bit0;
+    EXPECT_FALSE(arr.all());
+    EXPECT_TRUE(this->same(arr.reset(), bs.reset()));
+    EXPECT_TRUE(arr.none());
+    EXPECT_FALSE(arr.any());
+
+    typename TestFixture::full_array_type full(bit::bit1);
+    EXPECT_TRUE(full.all());
+    EXPECT_EQ(full.count(), full.size());
+    EXPECT_TRUE((~full).none());
+}
+
+TYPED_TEST(BitArrayTest, Equality) {
+    auto arr = this->random1;
+    EXPECT_TRUE(arr == this->random1);
+    EXPECT_FALSE(arr != this->random1);
+    arr.flip(TestFixture::size - 1);
+    EXPECT_FALSE(arr == this->random1);
+    EXPECT_TRUE(arr != this->random1);
+}
+
+TYPED_TEST(BitArrayTest, Algorithms) {
+    using WordType = TypeParam;
+    auto arr = this->random1;
+    EXPECT_EQ(arr.end() - arr.begin(), static_cast<std::ptrdiff_t>(TestFixture::size));
+    EXPECT_EQ(bit::count(arr.begin(), arr.end(), bit::bit1), arr.count());
+    EXPECT_EQ(bit::count(arr.cbegin(), arr.cend(), bit::bit1), arr.count());
+    EXPECT_TRUE(bit::equal(arr.begin(), arr.end(), this->random1.begin()));
+
+    bit::fill(arr.begin() + 1, arr.end() - 1, bit::bit0);
+    EXPECT_EQ(arr.count(), size_t((this->random1[0] == bit::bit1)
+                + (this->random1.back() == bit::bit1)));
+
+    arr.reset();
+    auto ret = bit::copy(this->random1.begin(), this->random1.end(), arr.begin());
+    EXPECT_EQ(ret, arr.end());
+    EXPECT_EQ(arr, this->random1);
+
+    bit::transform(this->random1.begin(), this->random1.end(), this->random2.begin(),
+            arr.begin(), std::bit_xor<WordType>());
+    EXPECT_EQ(arr, this->random1 ^ this->random2);
+
+    arr.reset();
+    arr[TestFixture::digits + 2] = bit::bit1;
+    EXPECT_EQ(bit::find(arr.begin(), arr.end(), bit::bit1) - arr.begin(),
+            static_cast<std::ptrdiff_t>(TestFixture::digits + 2));
+}
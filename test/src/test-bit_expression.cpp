@@ -0,0 +1,110 @@
+// ========================== BIT EXPRESSION TESTS ========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the lazy bitwise expressions over bit vectors
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template<typename WordType>
+class BitExpressionTest : public testing::Test {
+    protected:
+    using vec_type = bit::bit_vector<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+
+    vec_type random_vec(size_t size) {
+        auto words = get_random_vec<WordType>(size / digits + 1);
+        vec_type bv(words.begin(), words.end());
+        bv.resize(size);
+        return bv;
+    }
+};
+TYPED_TEST_SUITE(BitExpressionTest, BaseTypes);
+
+TYPED_TEST(BitExpressionTest, Operators) {
+    using vec_type = typename TestFixture::vec_type;
+    for (size_t size : {size_t(0), size_t(1), this->digits - 1, this->digits, 5 * this->digits + 3}) {
+        const vec_type a = this->random_vec(size);
+        const vec_type b = this->random_vec(size);
+        const vec_type c = this->random_vec(size);
+        const auto a_bool = boolvec_from_bitvec(a);
+        const auto b_bool = boolvec_from_bitvec(b);
+        const auto c_bool = boolvec_from_bitvec(c);
+
+        vec_type result = (a & b) | ~c;
+        vec_type difference = a - (b ^ c);
+        std::vector<bool> expected(size);
+        std::vector<bool> expected_difference(size);
+        for (size_t i = 0; i < size; ++i) {
+            expected[i] = (a_bool[i] && b_bool[i]) || !c_bool[i];
+            expected_difference[i] = a_bool[i] && !(b_bool[i] != c_bool[i]);
+        }
+        EXPECT_EQ(boolvec_from_bitvec(result), expected);
+        EXPECT_EQ(boolvec_from_bitvec(difference), expected_difference);
+
+        // Bits past the end stay cleared, so appending extends with zeros
+        result.resize(size + this->digits);
+        EXPECT_EQ(bit::count(result.begin() + size, result.end(), bit::bit1), 0);
+    }
+}
+
+TYPED_TEST(BitExpressionTest, Reductions) {
+    using vec_type = typename TestFixture::vec_type;
+    for (size_t size : {size_t(1), this->digits + 1, 7 * this->digits}) {
+        const vec_type a = this->random_vec(size);
+        const vec_type b = this->random_vec(size);
+        const auto a_bool = boolvec_from_bitvec(a);
+        const auto b_bool = boolvec_from_bitvec(b);
+        size_t expected = 0;
+        for (size_t i = 0; i < size; ++i) {
+            expected += a_bool[i] != b_bool[i];
+        }
+        EXPECT_EQ((a ^ b).count(), expected);
+        EXPECT_EQ((a ^ b).any(), expected != 0);
+        EXPECT_EQ((a ^ b).none(), expected == 0);
+        EXPECT_EQ((a ^ b).all(), expected == size);
+
+        // The complement sets the bits past the end of the last word, which
+        // must not be counted
+        const vec_type zeros(size, bit::bit0);
+        EXPECT_EQ((~zeros).count(), size);
+        EXPECT_TRUE((~zeros).all());
+        EXPECT_TRUE((a - a).none());
+        EXPECT_FALSE((a & ~a).any());
+    }
+}
+
+TYPED_TEST(BitExpressionTest, Aliasing) {
+    using vec_type = typename TestFixture::vec_type;
+    const size_t size = 9 * this->digits + 5;
+    vec_type a = this->random_vec(size);
+    const vec_type b = this->random_vec(size);
+    const auto a_bool = boolvec_from_bitvec(a);
+    const auto b_bool = boolvec_from_bitvec(b);
+    const auto data = a.data();
+    a = (a - b) | (b & ~a);
+    EXPECT_EQ(a.data(), data);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(a[i] == bit::bit1, a_bool[i] != b_bool[i]) << i;
+    }
+
+    // Assignment resizes the destination
+    vec_type c;
+    c = ~b;
+    EXPECT_EQ(c.size(), size);
+    EXPECT_EQ((c | b).count(), size);
+    EXPECT_TRUE((c & b).none());
+}
@@ -0,0 +1,154 @@
+// ============================== BIT SPAN TESTS ============================ //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the non-owning bit_span view
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <type_traits>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+static_assert(sizeof(bit::bit_span<std::uint64_t, 100>) == 2*sizeof(void*));
+static_assert(std::is_convertible_v<bit::bit_span<std::uint64_t, 100>,
+        bit::bit_span<const std::uint64_t>>);
+static_assert(!std::is_convertible_v<bit::bit_span<const std::uint64_t>,
+        bit::bit_span<std::uint64_t>>);
+
+// Spans are taken at unaligned offsets into a buffer of random words, and
+// checked against a std::vector<bool> copy of the same bits
+template<typename WordType>
+class BitSpanTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    const size_t num_words = 9;
+    std::vector<WordType> words1;
+    std::vector<WordType> words2;
+    std::vector<bool> bools1;
+    std::vector<bool> bools2;
+
+    void SetUp() override {
+        words1 = get_random_vec<WordType>(num_words);
+        words2 = get_random_vec<WordType>(num_words);
+        bools1 = boolvec_from_bitvec(bit::bit_vector<WordType>(words1.begin(), words1.end()));
+        bools2 = boolvec_from_bitvec(bit::bit_vector<WordType>(words2.begin(), words2.end()));
+    }
+
+    template <class Span>
+    static std::vector<bool> to_boolvec(const Span& span) {
+        std::vector<bool> ret;
+        for (auto it = span.begin(); it != span.end(); ++it) {
+            ret.push_back(*it == bit::bit1);
+        }
+        return ret;
+    }
+};
+TYPED_TEST_SUITE(BitSpanTest, BaseTypes);
+
+TYPED_TEST(BitSpanTest, View) {
+    using WordType = TypeParam;
+    const size_t offset = this->digits + 3;
+    const size_t length = 5*this->digits + 2;
+    bit::bit_span span(this->words1.data(), offset, length);
+    static_assert(std::is_same_v<decltype(span), bit::bit_span<WordType>>);
+    EXPECT_EQ(span.size(), length);
+    EXPECT_EQ(span.data(), this->words1.data() + 1);
+    EXPECT_EQ(span.offset(), 3u);
+    std::vector<bool> expected(this->bools1.begin() + offset, this->bools1.begin() + offset + length);
+    EXPECT_EQ(this->to_boolvec(span), expected);
+    EXPECT_EQ(span.front() == bit::bit1, expected.front());
+    EXPECT_EQ(span.back() == bit::bit1, expected.back());
+    EXPECT_EQ(span.count(), static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+
+    // Writes go straight to the words
+    span[0] = ~span[0];
+    EXPECT_EQ(bit::bit_span(this->words1.data(), this->words1.size()*this->digits)[offset] == bit::bit1,
+            !expected[0]);
+
+    bit::bit_span<const WordType> cspan = span;
+    EXPECT_EQ(cspan.data(), span.data());
+    EXPECT_EQ(cspan.size(), span.size());
+    EXPECT_EQ(bit::count(cspan.begin(), cspan.end(), bit::bit1), span.count());
+
+    bit::bit_span<WordType> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+}
+
+TYPED_TEST(BitSpanTest, Subviews) {
+    using WordType = TypeParam;
+    const size_t length = 6*this->digits + 1;
+    bit::bit_span<WordType> span(this->words1.data(), 2, length);
+    std::vector<bool> expected(this->bools1.begin() + 2, this->bools1.begin() + 2 + length);
+
+    auto head = span.first(this->digits + 1);
+    EXPECT_EQ(this->to_boolvec(head),
+            std::vector<bool>(expected.begin(), expected.begin() + this->digits + 1));
+    auto tail = span.last(7);
+    EXPECT_EQ(this->to_boolvec(tail), std::vector<bool>(expected.end() - 7, expected.end()));
+    auto mid = span.subspan(5, 2*this->digits);
+    EXPECT_EQ(this->to_boolvec(mid),
+            std::vector<bool>(expected.begin() + 5, expected.begin() + 5 + 2*this->digits));
+    EXPECT_EQ(this->to_boolvec(span.subspan(9)), std::vector<bool>(expected.begin() + 9, expected.end()));
+    EXPECT_EQ(mid.subspan(3, 4).begin(), span.begin() + 8);
+
+    auto fixed = span.template first<10>();
+    static_assert(std::is_same_v<decltype(fixed), bit::bit_span<WordType, 10>>);
+    EXPECT_EQ(fixed.size(), 10u);
+    auto fixed_mid = fixed.template subspan<2>();
+    static_assert(std::is_same_v<decltype(fixed_mid), bit::bit_span<WordType, 8>>);
+    auto fixed_last = fixed.template last<3>();
+    EXPECT_EQ(fixed_last.begin(), span.begin() + 7);
+    EXPECT_EQ(this->to_boolvec(fixed_mid.template subspan<1, 4>()),
+            std::vector<bool>(expected.begin() + 3, expected.begin() + 7));
+    bit::bit_span<WordType> dynamic = fixed_mid;
+    EXPECT_EQ(dynamic.size(), 8u);
+}
+
+TYPED_TEST(BitSpanTest, Operations) {
+    using WordType = TypeParam;
+    const size_t length = 4*this->digits + 5;
+    bit::bit_span<WordType> span1(this->words1.data(), 3, length);
+    bit::bit_span<const WordType> span2(this->words2.data(), this->digits - 1, length);
+    std::vector<bool> b1(this->bools1.begin() + 3, this->bools1.begin() + 3 + length);
+    std::vector<bool> b2(this->bools2.begin() + this->digits - 1,
+            this->bools2.begin() + this->digits - 1 + length);
+    const auto before = this->words1;
+
+    auto apply = [&](auto op) {
+        for (size_t i = 0; i < length; ++i) {
+            b1[i] = op(b1[i], b2[i]);
+        }
+    };
+    span1 &= span2;
+    apply(std::bit_and<bool>());
+    EXPECT_EQ(this->to_boolvec(span1), b1);
+    span1 |= span2;
+    apply(std::bit_or<bool>());
+    EXPECT_EQ(this->to_boolvec(span1), b1);
+    span1 ^= span2;
+    apply(std::bit_xor<bool>());
+    EXPECT_EQ(this->to_boolvec(span1), b1);
+    span1.flip();
+    b1.flip();
+    EXPECT_EQ(this->to_boolvec(span1), b1);
+    span1.fill(bit::bit1);
+    EXPECT_EQ(span1.count(), length);
+
+    // Bits outside of the span are untouched
+    bit::bit_span<WordType> all(this->words1.data(), this->num_words*this->digits);
+    bit::bit_span<const WordType> all_before(before.data(), this->num_words*this->digits);
+    EXPECT_EQ(this->to_boolvec(all.first(3)), this->to_boolvec(all_before.first(3)));
+    EXPECT_EQ(this->to_boolvec(all.subspan(3 + length)), this->to_boolvec(all_before.subspan(3 + length)));
+}
@@ -0,0 +1,179 @@
+// ============================= BIT STREAM TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the bit field writer and reader
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Fields of random widths, checked against a std::vector<bool> holding the
+// same bits
+template<typename WordType>
+class BitStreamTest : public testing::Test {
+    protected:
+    const size_t digits = bit::binary_digits<WordType>::value;
+    std::vector<std::pair<std::uint64_t, unsigned int>> fields;
+    std::vector<bool> bools;
+
+    void SetUp() override {
+        for (int i = 0; i < 2000; ++i) {
+            const unsigned int width = generate_random_number(0, 64);
+            const std::uint64_t value = generate_random_number(
+                    std::uint64_t(0), std::numeric_limits<std::uint64_t>::max());
+            fields.emplace_back(value, width);
+            for (unsigned int b = 0; b < width; ++b) {
+                bools.push_back((value >> b) & 1);
+            }
+        }
+    }
+
+    static std::uint64_t low_bits(std::uint64_t value, unsigned int width) {
+        return width == 64 ? value : value & ((std::uint64_t(1) << width) - 1);
+    }
+};
+TYPED_TEST_SUITE(BitStreamTest, BaseTypes);
+
+TYPED_TEST(BitStreamTest, WriteAndRead) {
+    using WordType = TypeParam;
+    bit::bit_vector<WordType> bv;
+    {
+        bit::bit_writer<WordType> writer(bv);
+        for (auto [value, width] : this->fields) {
+            writer.put(value, width);
+        }
+        EXPECT_EQ(writer.size(), this->bools.size());
+    }
+    ASSERT_EQ(bv.size(), this->bools.size());
+    EXPECT_EQ(boolvec_from_bitvec(bv), this->bools);
+
+    bit::bit_reader<WordType> reader(bv);
+    EXPECT_EQ(reader.remaining(), bv.size());
+    for (auto [value, width] : this->fields) {
+        ASSERT_EQ(reader.peek(width), this->low_bits(value, width));
+        ASSERT_EQ(reader.get(width), this->low_bits(value, width));
+    }
+    EXPECT_TRUE(reader.empty());
+    EXPECT_EQ(reader.position(), bv.size());
+    EXPECT_EQ(reader.get(0), 0u);
+    EXPECT_THROW(reader.get(1), std::out_of_range);
+}
+
+TYPED_TEST(BitStreamTest, StaticWidths) {
+    using WordType = TypeParam;
+    bit::bit_vector<WordType> bv;
+    bit::bit_writer<WordType> writer(bv);
+    for (int i = 0; i < 300; ++i) {
+        writer.template put<1>(i);
+        writer.template put<7>(i);
+        writer.template put<13>(i * 977);
+        writer.template put<64>(~std::uint64_t(i));
+        writer.put(bit::bit_value(i % 3 == 0));
+    }
+    writer.flush();
+    EXPECT_EQ(bv.size(), 300u * (1 + 7 + 13 + 64 + 1));
+
+    bit::bit_reader<WordType> reader(bv);
+    for (int i = 0; i < 300; ++i) {
+        ASSERT_EQ(reader.template get<1>(), std::uint64_t(i & 1));
+        ASSERT_EQ(reader.template get<7>(), std::uint64_t(i & 127));
+        ASSERT_EQ(reader.template get<13>(), std::uint64_t((i * 977) & 8191));
+        ASSERT_EQ(reader.template get<64>(), ~std::uint64_t(i));
+        ASSERT_EQ(reader.get_bit(), bit::bit_value(i % 3 == 0));
+    }
+    EXPECT_TRUE(reader.empty());
+}
+
+TYPED_TEST(BitStreamTest, Append) {
+    using WordType = TypeParam;
+    // Writing continues after a partial last word, and after a flush
+    bit::bit_vector<WordType> bv(this->digits + 3, bit::bit1);
+    std::vector<bool> expected(this->digits + 3, true);
+    bit::bit_writer<WordType> writer(bv);
+    for (size_t i = 0; i < this->fields.size(); ++i) {
+        auto [value, width] = this->fields[i];
+        writer.put(value, width);
+        if (i % 100 == 0) {
+            writer.flush();
+            ASSERT_EQ(bv.size(), writer.size());
+        }
+    }
+    writer.flush();
+    expected.insert(expected.end(), this->bools.begin(), this->bools.end());
+    EXPECT_EQ(boolvec_from_bitvec(bv), expected);
+}
+
+TYPED_TEST(BitStreamTest, Buffer) {
+    using WordType = TypeParam;
+    std::vector<WordType> words(this->bools.size() / this->digits + 1);
+    {
+        bit::bit_writer<WordType> writer(words.data(), words.size());
+        for (auto [value, width] : this->fields) {
+            writer.put(value, width);
+        }
+    }
+    bit::bit_span<const WordType> span(words.data(), this->bools.size());
+    for (size_t i = 0; i < this->bools.size(); ++i) {
+        ASSERT_EQ(span[i] == bit::bit1, this->bools[i]) << i;
+    }
+
+    // A full buffer throws instead of overflowing
+    std::vector<WordType> small(64 / this->digits);
+    bit::bit_writer<WordType> writer(small.data(), small.size());
+    writer.put(~std::uint64_t(0), 60);
+    writer.put(0, 4);
+    writer.flush();
+    EXPECT_EQ(small.back(), static_cast<WordType>(0x0FFFFFFFFFFFFFFFULL >> (64 - this->digits)));
+    writer.put(0, 1);
+    EXPECT_THROW(writer.flush(), std::length_error);
+}
+
+TYPED_TEST(BitStreamTest, SkipAndSpan) {
+    using WordType = TypeParam;
+    bit::bit_vector<WordType> bv;
+    {
+        bit::bit_writer<WordType> writer(bv);
+        for (auto [value, width] : this->fields) {
+            writer.put(value, width);
+        }
+    }
+    // Skips of every size, through the accumulator and past whole words
+    bit::bit_reader<WordType> reader(bv);
+    size_t pos = 0;
+    for (size_t n = 0; pos + n + 17 <= this->bools.size(); n = (n * 7 + 5) % (5 * this->digits)) {
+        reader.skip(n);
+        pos += n;
+        ASSERT_EQ(reader.position(), pos);
+        std::uint64_t value = reader.get(17);
+        for (unsigned int b = 0; b < 17; ++b) {
+            ASSERT_EQ(((value >> b) & 1) != 0, this->bools[pos + b]) << pos;
+        }
+        pos += 17;
+    }
+    EXPECT_THROW(reader.skip(reader.remaining() + 1), std::out_of_range);
+
+    // Readers over a span start at its first bit
+    const size_t offset = this->digits + 5;
+    bit::bit_span<const WordType> span(bv.data(), offset, 3 * this->digits);
+    bit::bit_reader<WordType> span_reader(span);
+    EXPECT_EQ(span_reader.position(), 0u);
+    EXPECT_EQ(span_reader.remaining(), 3 * this->digits);
+    for (size_t i = 0; i < 3 * this->digits; ++i) {
+        ASSERT_EQ(span_reader.get(1) != 0, this->bools[offset + i]) << i;
+    }
+    EXPECT_TRUE(span_reader.empty());
+}
@@ -0,0 +1,174 @@
+// ============================= DISPATCH TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the runtime selection of the SIMD word kernels
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Every algorithm is run with each target the CPU supports, and must give the
+// same result as with the scalar kernels
+template<typename WordType>
+class DispatchTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    using vec_type = bit::bit_vector<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    // Long enough for several blocks of every kernel, plus a partial word
+    const size_t bit_size = 300*digits + 11;
+    std::vector<bit::simd::target> targets;
+    vec_type random1;
+    vec_type random2;
+
+    void SetUp() override {
+        for (auto t : {bit::simd::target::scalar, bit::simd::target::avx2, bit::simd::target::avx512}) {
+            if (bit::simd::supported(t)) {
+                targets.push_back(t);
+            }
+        }
+        const size_t word_size = (bit_size + digits - 1) / digits;
+        auto words1 = get_random_vec<WordType>(word_size);
+        auto words2 = get_random_vec<WordType>(word_size);
+        random1 = vec_type(words1.begin(), words1.end());
+        random2 = vec_type(words2.begin(), words2.end());
+        random1.resize(bit_size);
+        random2.resize(bit_size);
+    }
+
+    void TearDown() override {
+        bit::simd::reset_target();
+    }
+
+    // Runs f once per target and checks that it returns the same value as
+    // with the scalar kernels
+    template <class F>
+    void expect_same_for_all_targets(F f) {
+        bit::simd::set_target(bit::simd::target::scalar);
+        const auto expected = f();
+        for (auto t : targets) {
+            bit::simd::set_target(t);
+            EXPECT_EQ(f(), expected) << "target " << bit::simd::target_name(t);
+        }
+    }
+};
+TYPED_TEST_SUITE(DispatchTest, BaseTypes);
+
+TYPED_TEST(DispatchTest, Targets) {
+    EXPECT_EQ(bit::simd::current_target(), bit::simd::detected_target());
+    EXPECT_TRUE(bit::simd::supported(bit::simd::target::scalar));
+    for (auto t : {bit::simd::target::avx2, bit::simd::target::avx512}) {
+        if (bit::simd::supported(t)) {
+            bit::simd::set_target(t);
+            EXPECT_EQ(bit::simd::current_target(), t);
+        } else {
+            EXPECT_THROW(bit::simd::set_target(t), std::invalid_argument);
+        }
+    }
+    bit::simd::set_target(bit::simd::target::scalar);
+    EXPECT_EQ(bit::simd::current_target(), bit::simd::target::scalar);
+    bit::simd::reset_target();
+    EXPECT_EQ(bit::simd::current_target(), bit::simd::detected_target());
+}
+
+TYPED_TEST(DispatchTest, Count) {
+    auto boolvec = boolvec_from_bitvec(this->random1);
+    for (size_t start : {size_t(0), size_t(3), this->digits + 1}) {
+        auto first = this->random1.begin() + start;
+        auto last = this->random1.end() - 1;
+        this->expect_same_for_all_targets([&]() {
+            return bit::count(first, last, bit::bit1);
+        });
+        bit::simd::reset_target();
+        EXPECT_EQ(bit::count(first, last, bit::bit1),
+                std::count(boolvec.begin() + start, boolvec.end() - 1, true));
+    }
+}
+
+TYPED_TEST(DispatchTest, Find) {
+    auto bv = this->random1;
+    bit::fill(bv.begin(), bv.end(), bit::bit0);
+    // A single hit anywhere in the range, including the tail of a block
+    for (size_t hit : {size_t(1), this->digits, 20*this->digits + 3, this->bit_size - 2}) {
+        bv[hit] = bit::bit1;
+        this->expect_same_for_all_targets([&]() {
+            return bit::find(bv.begin(), bv.end(), bit::bit1) - bv.begin();
+        });
+        EXPECT_EQ(bit::find(bv.begin(), bv.end(), bit::bit1), bv.begin() + hit);
+        auto ones = bv;
+        bit::fill(ones.begin(), ones.end(), bit::bit1);
+        ones[hit] = bit::bit0;
+        EXPECT_EQ(bit::find(ones.begin(), ones.end(), bit::bit0), ones.begin() + hit);
+        bv[hit] = bit::bit0;
+    }
+    this->expect_same_for_all_targets([&]() {
+        return bit::find(bv.begin(), bv.end(), bit::bit1) - bv.begin();
+    });
+}
+
+TYPED_TEST(DispatchTest, Fill) {
+    for (size_t start : {size_t(0), size_t(5)}) {
+        this->expect_same_for_all_targets([&]() {
+            auto bv = this->random1;
+            bit::fill(bv.begin() + start, bv.end() - 3, bit::bit1);
+            return boolvec_from_bitvec(bv);
+        });
+    }
+}
+
+TYPED_TEST(DispatchTest, Transform) {
+    using WordType = typename TestFixture::base_type;
+    this->expect_same_for_all_targets([&]() {
+        auto bv = this->random2;
+        bit::transform(this->random1.begin(), this->random1.end(), bv.begin(),
+                std::bit_not<WordType>());
+        return boolvec_from_bitvec(bv);
+    });
+    this->expect_same_for_all_targets([&]() {
+        auto bv = this->random2;
+        bit::transform(this->random1.begin(), this->random1.end(), this->random2.begin(),
+                bv.begin(), std::bit_xor<WordType>());
+        return boolvec_from_bitvec(bv);
+    });
+    // Sources at the same offset, and at different ones
+    for (size_t start2 : {size_t(3), size_t(5)}) {
+        this->expect_same_for_all_targets([&]() {
+            auto bv = this->random2;
+            bit::transform(this->random1.begin() + 3, this->random1.end() - 2,
+                    this->random2.begin() + start2, bv.begin(), std::bit_xor<WordType>());
+            return boolvec_from_bitvec(bv);
+        });
+    }
+}
+
+TYPED_TEST(DispatchTest, Shift) {
+    const size_t digits = this->digits;
+    for (size_t n : {size_t(1), digits - 1, digits + 3, 17*digits + 5}) {
+        this->expect_same_for_all_targets([&]() {
+            auto bv = this->random1;
+            auto ret = bit::shift_left(bv.begin() + 1, bv.end(), n);
+            bit::fill(ret, bv.end(), bit::bit0);
+            return boolvec_from_bitvec(bv);
+        });
+        this->expect_same_for_all_targets([&]() {
+            auto bv = this->random1;
+            auto ret = bit::shift_right(bv.begin() + 1, bv.end(), n);
+            bit::fill(bv.begin() + 1, ret, bit::bit0);
+            return boolvec_from_bitvec(bv);
+        });
+    }
+}
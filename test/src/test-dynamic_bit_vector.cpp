@@ -0,0 +1,231 @@
+// ========================= DYNAMIC BIT VECTOR TESTS ======================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the B+tree backed dynamic bit vector
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// When non-negative, the allocation after that many more fails, so that the
+// tests can check that a failed allocation leaves the tree untouched. These
+// replace the global allocation functions of the whole test binary, so the
+// forms that are not replaced must not free memory from the ones that are.
+static long allocations_before_failure = -1;
+
+void* operator new(std::size_t n) {
+    if (allocations_before_failure == 0) {
+        allocations_before_failure = -1;
+        throw std::bad_alloc();
+    }
+    if (allocations_before_failure > 0) {
+        --allocations_before_failure;
+    }
+    if (void* p = std::malloc(n ? n : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t n, const std::nothrow_t&) noexcept {
+    try {
+        return operator new(n);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+void operator delete(void* p) noexcept {std::free(p);}
+void operator delete(void* p, std::size_t) noexcept {std::free(p);}
+void operator delete(void* p, const std::nothrow_t&) noexcept {std::free(p);}
+
+// Blocks of two words and nodes of four children give deep trees, where
+// every split and merge path is taken after a few hundred edits
+template<typename WordType>
+class DynamicBitVectorTest : public testing::Test {
+    protected:
+    using vec_type = bit::dynamic_bit_vector<WordType, 2, 4>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+
+    // Reads the bits back through the segments
+    template <class Vector>
+    static std::vector<bool> to_boolvec(const Vector& vec) {
+        std::vector<bool> ret;
+        for (auto segment : vec.segments()) {
+            for (auto it = segment.begin(); it != segment.end(); ++it) {
+                ret.push_back(*it == bit::bit1);
+            }
+        }
+        return ret;
+    }
+
+    template <class Vector>
+    static void check(const Vector& vec, const std::vector<bool>& expected) {
+        ASSERT_EQ(vec.size(), expected.size());
+        ASSERT_EQ(vec.count(), static_cast<size_t>(std::count(expected.begin(), expected.end(), true)));
+        ASSERT_EQ(to_boolvec(vec), expected);
+        size_t ones = 0;
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(vec.rank(i), ones) << i;
+            ASSERT_EQ(vec[i] == bit::bit1, expected[i]) << i;
+            ones += expected[i];
+        }
+        ASSERT_EQ(vec.rank(expected.size()), ones);
+    }
+};
+TYPED_TEST_SUITE(DynamicBitVectorTest, BaseTypes);
+
+TYPED_TEST(DynamicBitVectorTest, RandomEdits) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type vec;
+    std::vector<bool> expected;
+    for (int step = 0; step < 6000; ++step) {
+        // Grow for the first half, and shrink down to nothing afterwards
+        const bool grow = step < 3000;
+        const size_t op = generate_random_number(0, 9);
+        const bool value = generate_random_number(0, 1);
+        if (expected.empty() || (grow && op < 6) || (!grow && op < 2)) {
+            const size_t pos = generate_random_number(0, expected.size());
+            vec.insert(pos, bit::bit_value(value));
+            expected.insert(expected.begin() + pos, value);
+        } else if (op < 8) {
+            const size_t pos = generate_random_number(0, expected.size() - 1);
+            ASSERT_EQ(vec.erase(pos) == bit::bit1, expected[pos]);
+            expected.erase(expected.begin() + pos);
+        } else if (op == 8) {
+            const size_t pos = generate_random_number(0, expected.size() - 1);
+            vec.set(pos, bit::bit_value(value));
+            expected[pos] = value;
+        } else {
+            const size_t pos = generate_random_number(0, expected.size() - 1);
+            vec.flip(pos);
+            expected[pos] = !expected[pos];
+        }
+        if (step % 500 == 0) {
+            this->check(vec, expected);
+        }
+    }
+    while (!expected.empty()) {
+        vec.pop_back();
+        expected.pop_back();
+    }
+    this->check(vec, expected);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.segments().begin(), vec.segments().end());
+}
+
+TYPED_TEST(DynamicBitVectorTest, Construction) {
+    using WordType = TypeParam;
+    using vec_type = typename TestFixture::vec_type;
+    const size_t n = 40 * this->digits + 7;
+    auto words = get_random_vec<WordType>(41);
+    bit::bit_vector<WordType> bv(words.begin(), words.end());
+    bv.resize(n);
+    std::vector<bool> expected = boolvec_from_bitvec(bv);
+
+    vec_type vec(bv.begin(), bv.end());
+    this->check(vec, expected);
+    vec_type copy(vec);
+    this->check(copy, expected);
+
+    // Copies do not share blocks
+    copy.insert(3, bit::bit1);
+    copy.erase(n / 2);
+    this->check(vec, expected);
+    vec_type moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    copy = vec;
+    this->check(copy, expected);
+
+    vec_type ones(3 * this->digits + 1, bit::bit1);
+    this->check(ones, std::vector<bool>(3 * this->digits + 1, true));
+    ones.clear();
+    EXPECT_TRUE(ones.empty());
+    ones.push_back(bit::bit1);
+    EXPECT_EQ(ones.front(), bit::bit1);
+    EXPECT_EQ(ones.back(), bit::bit1);
+    EXPECT_THROW(ones.at(1), std::out_of_range);
+}
+
+// Every insert is retried with its k-th allocation failing, for growing k,
+// until it goes through
+TYPED_TEST(DynamicBitVectorTest, FailedAllocations) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type vec;
+    std::vector<bool> expected;
+    size_t failures = 0;
+    for (int step = 0; step < 600; ++step) {
+        const size_t pos = generate_random_number(0, expected.size());
+        const bool value = generate_random_number(0, 1);
+        for (long k = 0;; ++k) {
+            allocations_before_failure = k;
+            try {
+                vec.insert(pos, bit::bit_value(value));
+            } catch (const std::bad_alloc&) {
+                ++failures;
+                allocations_before_failure = -1;
+                this->check(vec, expected);
+                continue;
+            }
+            allocations_before_failure = -1;
+            break;
+        }
+        expected.insert(expected.begin() + pos, value);
+    }
+    this->check(vec, expected);
+    EXPECT_GT(failures, 0u);
+
+    // A failed construction frees the nodes it built
+    for (long k = 0;; ++k) {
+        allocations_before_failure = k;
+        try {
+            vec_type ones(50 * this->digits, bit::bit1);
+            allocations_before_failure = -1;
+            this->check(ones, std::vector<bool>(50 * this->digits, true));
+            break;
+        } catch (const std::bad_alloc&) {
+            allocations_before_failure = -1;
+        }
+    }
+}
+
+TYPED_TEST(DynamicBitVectorTest, Segments) {
+    using WordType = TypeParam;
+    const size_t n = 5000;
+    auto words = get_random_vec<WordType>(n / this->digits + 1);
+    bit::bit_vector<WordType> bv(words.begin(), words.end());
+    bv.resize(n);
+    bit::dynamic_bit_vector<WordType> vec(bv.begin(), bv.end());
+    for (size_t i = 0; i < 1000; ++i) {
+        vec.insert(generate_random_number(0, vec.size()), bit::bit1);
+    }
+
+    // Algorithms run on each block, and the blocks cover the vector in order
+    size_t ones = 0;
+    size_t total = 0;
+    bit::bit_vector<WordType> flat(vec.size());
+    bit::for_each_segment(vec, [&](auto segment) {
+        ones += bit::count(segment.begin(), segment.end(), bit::bit1);
+        bit::copy(segment.begin(), segment.end(), bit::bit_iterator<WordType*>(flat.data()) + total);
+        total += segment.size();
+    });
+    EXPECT_EQ(total, vec.size());
+    EXPECT_EQ(ones, vec.count());
+    for (size_t i = 0; i < vec.size(); ++i) {
+        ASSERT_EQ(flat[i], vec[i]) << i;
+    }
+}
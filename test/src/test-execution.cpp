@@ -0,0 +1,241 @@
+// ============================ EXECUTION TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the parallel algorithm overloads
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template<typename WordType>
+class ParallelTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    using vec_type = bit::bit_vector<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    const size_t bit_size = 200*digits + 13;
+    bit::execution::thread_pool pool{4};
+    // A grain which is not a multiple of the word size, so chunks are
+    // rounded to word boundaries
+    bit::execution::parallel_policy policy =
+        bit::execution::par.on(pool).with_grain(3*digits + 5);
+    vec_type random1;
+    vec_type random2;
+
+    void SetUp() override {
+        const size_t word_size = (bit_size + digits - 1) / digits;
+        auto words1 = get_random_vec<WordType>(word_size);
+        auto words2 = get_random_vec<WordType>(word_size);
+        random1 = vec_type(words1.begin(), words1.end());
+        random2 = vec_type(words2.begin(), words2.end());
+        random1.resize(bit_size);
+        random2.resize(bit_size);
+    }
+};
+TYPED_TEST_SUITE(ParallelTest, BaseTypes);
+
+TYPED_TEST(ParallelTest, Count) {
+    auto& bv = this->random1;
+    for (size_t start : {size_t(0), size_t(1), this->digits - 1, 2*this->digits + 3}) {
+        for (size_t end : {size_t(0), size_t(3), this->digits}) {
+            auto first = bv.begin() + start;
+            auto last = bv.end() - end;
+            EXPECT_EQ(bit::count(this->policy, first, last, bit::bit1),
+                    bit::count(first, last, bit::bit1));
+            EXPECT_EQ(bit::count(bit::execution::par_unseq, first, last, bit::bit0),
+                    bit::count(first, last, bit::bit0));
+            EXPECT_EQ(bit::count(bit::execution::seq, first, last, bit::bit0),
+                    bit::count(first, last, bit::bit0));
+        }
+    }
+}
+
+TYPED_TEST(ParallelTest, Fill) {
+    for (size_t start : {size_t(0), size_t(5), this->digits + 1}) {
+        for (size_t end : {size_t(0), size_t(2), this->digits + 7}) {
+            auto expected = this->random1;
+            auto bv = this->random1;
+            bit::fill(expected.begin() + start, expected.end() - end, bit::bit1);
+            bit::fill(this->policy, bv.begin() + start, bv.end() - end, bit::bit1);
+            EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+            bit::fill(expected.begin() + start, expected.end() - end, bit::bit0);
+            bit::fill(this->policy, bv.begin() + start, bv.end() - end, bit::bit0);
+            EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+        }
+    }
+}
+
+TYPED_TEST(ParallelTest, Copy) {
+    for (size_t src_start : {size_t(0), size_t(3), this->digits + 1}) {
+        for (size_t dst_start : {size_t(0), size_t(1), this->digits - 1}) {
+            auto expected = this->random2;
+            auto bv = this->random2;
+            const size_t n = this->bit_size - std::max(src_start, dst_start) - 2;
+            auto src = this->random1.begin() + src_start;
+            auto ret = bit::copy(this->policy, src, src + n, bv.begin() + dst_start);
+            bit::copy(src, src + n, expected.begin() + dst_start);
+            EXPECT_EQ(ret, bv.begin() + dst_start + n);
+            EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+        }
+    }
+}
+
+TYPED_TEST(ParallelTest, Equal) {
+    auto copy = this->random1;
+    const size_t n = this->bit_size - this->digits;
+    EXPECT_TRUE(bit::equal(this->policy, this->random1.begin(), this->random1.end(), copy.begin()));
+    EXPECT_TRUE(bit::equal(this->policy, this->random1.begin() + 3, this->random1.begin() + n, copy.begin() + 3));
+    for (size_t pos : {size_t(0), this->digits + 2, this->bit_size / 2, this->bit_size - 1}) {
+        copy[pos] = ~copy[pos];
+        EXPECT_FALSE(bit::equal(this->policy, this->random1.begin(), this->random1.end(), copy.begin()));
+        copy[pos] = ~copy[pos];
+    }
+}
+
+TYPED_TEST(ParallelTest, Transform) {
+    using WordType = typename TestFixture::base_type;
+    for (size_t start : {size_t(0), size_t(1), this->digits + 3}) {
+        for (size_t dst_start : {size_t(0), size_t(2), this->digits - 1}) {
+            const size_t n = this->bit_size - std::max(start, dst_start) - 1;
+            auto first1 = this->random1.begin() + start;
+            auto first2 = this->random2.begin() + start;
+
+            auto expected = this->random2;
+            auto bv = this->random2;
+            bit::transform(first1, first1 + n, expected.begin() + dst_start, std::bit_not<WordType>());
+            auto ret = bit::transform(this->policy, first1, first1 + n, bv.begin() + dst_start, std::bit_not<WordType>());
+            EXPECT_EQ(ret, bv.begin() + dst_start + n);
+            EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+
+            bit::transform(first1, first1 + n, first2, expected.begin() + dst_start, std::bit_xor<WordType>());
+            ret = bit::transform(this->policy, first1, first1 + n, first2, bv.begin() + dst_start, std::bit_xor<WordType>());
+            EXPECT_EQ(ret, bv.begin() + dst_start + n);
+            EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+        }
+    }
+}
+
+TYPED_TEST(ParallelTest, Find) {
+    auto bv = this->random1;
+    bit::fill(bv.begin(), bv.end(), bit::bit0);
+    for (size_t start : {size_t(0), size_t(1), this->digits + 3}) {
+        auto first = bv.begin() + start;
+        auto last = bv.end() - 2;
+        EXPECT_EQ(bit::find(this->policy, first, last, bit::bit1), last);
+        EXPECT_EQ(bit::find_last(this->policy, first, last, bit::bit1), last);
+        // Several hits spread over different chunks; the extreme ones win
+        std::vector<size_t> hits = {this->bit_size / 3, this->bit_size / 2, this->bit_size - 3};
+        for (size_t first_hit : {start, start + 1, this->bit_size / 5}) {
+            for (size_t hit : hits) {
+                bv[hit] = bit::bit1;
+            }
+            bv[first_hit] = bit::bit1;
+            EXPECT_EQ(bit::find(this->policy, first, last, bit::bit1), bv.begin() + first_hit);
+            EXPECT_EQ(bit::find_last(this->policy, first, last, bit::bit1), bv.begin() + hits.back());
+            EXPECT_EQ(bit::find_last(this->policy, first, last - 1, bit::bit1), bv.begin() + hits[1]);
+            EXPECT_EQ(bit::find(this->policy, first, last, bit::bit0), bit::find(first, last, bit::bit0));
+            EXPECT_EQ(bit::find_last(this->policy, first, last, bit::bit0), bit::find_last(first, last, bit::bit0));
+            bit::fill(bv.begin(), bv.end(), bit::bit0);
+        }
+    }
+    // Random contents agree with the serial algorithms
+    auto first = this->random1.begin() + 1;
+    auto last = this->random1.end() - 1;
+    EXPECT_EQ(bit::find(this->policy, first, last, bit::bit1), bit::find(first, last, bit::bit1));
+    EXPECT_EQ(bit::find_last(this->policy, first, last, bit::bit0), bit::find_last(first, last, bit::bit0));
+}
+
+TYPED_TEST(ParallelTest, Shift) {
+    const size_t digits = this->digits;
+    const size_t d = this->bit_size - 4;
+    for (size_t n : {size_t(0), size_t(1), digits - 1, digits, 3*digits + 5, d / 5, d / 2, d - 3, d}) {
+        auto expected = this->random1;
+        auto bv = this->random1;
+        auto first = bv.begin() + 1;
+        auto last = first + d;
+        // Only the shifted bits are specified, the rest must be untouched
+        auto ret = bit::shift_left(this->policy, first, last, n);
+        auto expected_ret = bit::shift_left(expected.begin() + 1, expected.begin() + 1 + d, n);
+        EXPECT_EQ(ret - bv.begin(), expected_ret - expected.begin());
+        EXPECT_TRUE(bit::equal(bv.begin(), ret, expected.begin()));
+        EXPECT_TRUE(bit::equal(last, bv.end(), expected.begin() + 1 + d));
+
+        expected = this->random1;
+        bv = this->random1;
+        ret = bit::shift_right(this->policy, first, last, n);
+        expected_ret = bit::shift_right(expected.begin() + 1, expected.begin() + 1 + d, n);
+        EXPECT_EQ(ret - bv.begin(), expected_ret - expected.begin());
+        EXPECT_TRUE(bit::equal(bv.begin(), first, expected.begin()));
+        EXPECT_TRUE(bit::equal(ret, bv.end(), expected_ret));
+    }
+}
+
+TYPED_TEST(ParallelTest, Rotate) {
+    const size_t digits = this->digits;
+    const size_t d = this->bit_size - 5;
+    for (size_t k : {size_t(0), size_t(3), digits, 2*digits + 1, d / 3, d / 2, d - digits - 2, d - 1, d}) {
+        auto expected = this->random1;
+        auto bv = this->random1;
+        auto ret = bit::rotate(this->policy, bv.begin() + 2, bv.begin() + 2 + k, bv.begin() + 2 + d);
+        auto expected_ret = bit::rotate(expected.begin() + 2, expected.begin() + 2 + k, expected.begin() + 2 + d);
+        EXPECT_EQ(ret - bv.begin(), expected_ret - expected.begin());
+        EXPECT_TRUE(bit::equal(bv.begin(), bv.end(), expected.begin()));
+    }
+}
+
+TEST(ThreadPool, ParallelForRunsEveryIndexOnce) {
+    bit::execution::thread_pool pool(4);
+    EXPECT_EQ(pool.concurrency(), 4u);
+    std::vector<std::atomic<int>> hits(1000);
+    pool.parallel_for(hits.size(), [&](size_t i) {
+        // Nested calls run serially on the worker
+        pool.parallel_for(2, [&](size_t) {hits[i]++;});
+    });
+    for (auto& h : hits) {
+        EXPECT_EQ(h.load(), 2);
+    }
+    pool.parallel_for(0, [](size_t) {FAIL();});
+}
+
+// The first exception is rethrown on the caller, whichever thread threw it,
+// and the pool stays usable
+TEST(ThreadPool, ParallelForRethrows) {
+    bit::execution::thread_pool pool(4);
+    for (size_t thrower : {size_t(0), size_t(37), size_t(999)}) {
+        std::atomic<size_t> calls{0};
+        EXPECT_THROW(pool.parallel_for(1000, [&](size_t i) {
+            calls++;
+            if (i == thrower) {
+                throw std::runtime_error("thrown");
+            }
+        }), std::runtime_error);
+        EXPECT_LE(calls.load(), 1000u);
+    }
+    std::atomic<size_t> calls{0};
+    pool.parallel_for(1000, [&](size_t) {calls++;});
+    EXPECT_EQ(calls.load(), 1000u);
+}
+
+TYPED_TEST(ParallelTest, TransformRethrows) {
+    using WordType = TypeParam;
+    auto bv = this->random1;
+    auto throwing = [](WordType, WordType) -> WordType {
+        throw std::runtime_error("thrown");
+    };
+    EXPECT_THROW(bit::transform(this->policy, bv.begin(), bv.end(), this->random2.begin(),
+            bv.begin(), throwing), std::runtime_error);
+}
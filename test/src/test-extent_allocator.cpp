@@ -0,0 +1,86 @@
+// ========================= EXTENT ALLOCATOR TESTS ========================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for extent_allocator
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template<typename WordType>
+class ExtentAllocatorTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    const size_t digits = bit::binary_digits<WordType>::value;
+};
+TYPED_TEST_SUITE(ExtentAllocatorTest, BaseTypes);
+
+TYPED_TEST(ExtentAllocatorTest, FirstFit) {
+    using WordType = typename TestFixture::base_type;
+    const size_t capacity = 10*this->digits + 3;
+    bit::extent_allocator<WordType> alloc(capacity);
+    EXPECT_EQ(alloc.policy(), bit::fit_policy::first_fit);
+    EXPECT_EQ(alloc.allocate(0), alloc.npos);
+    EXPECT_EQ(alloc.allocate(capacity + 1), alloc.npos);
+
+    // Extents are packed one after the other
+    const size_t a = alloc.allocate(3);
+    const size_t b = alloc.allocate(2*this->digits);
+    const size_t c = alloc.allocate(5);
+    EXPECT_EQ(a, 0u);
+    EXPECT_EQ(b, 3u);
+    EXPECT_EQ(c, 3 + 2*this->digits);
+    EXPECT_EQ(alloc.used(), 3 + 2*this->digits + 5);
+    EXPECT_FALSE(alloc.is_free(0, 1));
+    EXPECT_TRUE(alloc.is_free(c + 5, capacity - c - 5));
+    EXPECT_EQ(alloc.largest_free_extent(), capacity - c - 5);
+
+    // A freed hole is reused by the first request which fits in it
+    alloc.deallocate(b, 2*this->digits);
+    EXPECT_TRUE(alloc.is_free(b, 2*this->digits));
+    EXPECT_EQ(alloc.allocate(this->digits), b);
+    EXPECT_EQ(alloc.allocate(this->digits + 1), c + 5);
+    EXPECT_EQ(alloc.allocate(this->digits), b + this->digits);
+
+    // The whole remainder can be taken, and nothing more
+    const size_t rest = alloc.available();
+    EXPECT_EQ(alloc.largest_free_extent(), rest);
+    EXPECT_NE(alloc.allocate(rest), alloc.npos);
+    EXPECT_EQ(alloc.available(), 0u);
+    EXPECT_EQ(alloc.allocate(1), alloc.npos);
+    auto bitmap = alloc.bitmap();
+    EXPECT_EQ(bit::count(bitmap.begin(), bitmap.end(), bit::bit1),
+            static_cast<std::ptrdiff_t>(capacity));
+}
+
+TYPED_TEST(ExtentAllocatorTest, BestFit) {
+    using WordType = typename TestFixture::base_type;
+    const size_t digits = this->digits;
+    bit::extent_allocator<WordType> alloc(16*digits, bit::fit_policy::best_fit);
+    // Carve holes of 2*digits, 5 and digits blocks separated by used blocks
+    std::vector<size_t> extents;
+    for (size_t n : {2*digits, size_t(1), size_t(5), size_t(1), digits, size_t(1)}) {
+        extents.push_back(alloc.allocate(n, bit::fit_policy::first_fit));
+    }
+    alloc.deallocate(extents[0], 2*digits);
+    alloc.deallocate(extents[2], 5);
+    alloc.deallocate(extents[4], digits);
+
+    // Smallest hole that fits, exact fits first
+    EXPECT_EQ(alloc.allocate(5), extents[2]);
+    EXPECT_EQ(alloc.allocate(3), extents[4]);
+    EXPECT_EQ(alloc.allocate(digits + 1), extents[0]);
+    // First fit would have used the first hole
+    alloc.deallocate(extents[4], 3);
+    EXPECT_EQ(alloc.allocate(2, bit::fit_policy::first_fit), extents[0] + digits + 1);
+}
@@ -37,3 +37,21 @@ TYPED_TEST(SingleRangeTest, Find) {
 }
 
 
+
+TYPED_TEST(SingleRangeTest, FindLast) {
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        bit::bit_vector<typename TestFixture::base_type> bitvec = this->random_bitvecs[idx];
+        std::vector<bool> boolvec = this->random_boolvecs[idx];
+        size_t start_count = 16;
+        while (start_count--) {
+            unsigned long long start = generate_random_number(0, std::min<unsigned long long>(bitvec.size() - 1, 16));
+            unsigned long long end = generate_random_number(0, bitvec.size() - start);
+            for (bool value : {false, true}) {
+                auto bitret = bit::find_last(bitvec.begin() + start, bitvec.end() - end, value ? bit::bit1 : bit::bit0);
+                auto rboolret = std::find(boolvec.rbegin() + end, boolvec.rend() - start, value);
+                auto boolret = rboolret == boolvec.rend() - start ? boolvec.end() - end : std::prev(rboolret.base());
+                EXPECT_EQ(std::distance(bitvec.begin(), bitret), std::distance(boolvec.begin(), boolret));
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+// ============================ FIND RUN TESTS ============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for find_run
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TYPED_TEST(SingleRangeTest, FindRun) {
+    for (size_t idx = 0; idx < this->random_bitvecs.size(); ++idx) {
+        bit::bit_vector<typename TestFixture::base_type> bitvec = this->random_bitvecs[idx];
+        std::vector<bool> boolvec = this->random_boolvecs[idx];
+        size_t start_count = 8;
+        while (start_count--) {
+            unsigned long long start = generate_random_number(0, std::min<unsigned long long>(bitvec.size() - 1, 16));
+            for (size_t n : {1, 2, 3, 5, 7, 8, 13, 31, 64, 70, 200}) {
+                for (bool value : {false, true}) {
+                    const bit::bit_value bv = value ? bit::bit1 : bit::bit0;
+                    auto bitret = bit::find_run(bitvec.begin() + start, bitvec.end(), bv, n);
+                    auto boolret = std::search_n(boolvec.begin() + start, boolvec.end(), n, value);
+                    EXPECT_EQ(std::distance(bitvec.begin(), bitret), std::distance(boolvec.begin(), boolret));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST(SingleRangeTest, FindRunAcrossWords) {
+    using WordType = typename TestFixture::base_type;
+    const size_t digits = this->digits;
+    const size_t size = 8*digits;
+    // A single run of zeros in a sea of ones, at every offset and length
+    for (size_t run_start : {size_t(0), size_t(1), digits - 1, digits, 2*digits + 3}) {
+        for (size_t run_length : {size_t(1), digits - 1, digits, digits + 1, 3*digits + 2}) {
+            bit::bit_vector<WordType> bitvec(size, bit::bit1);
+            bit::fill(bitvec.begin() + run_start, bitvec.begin() + run_start + run_length, bit::bit0);
+            for (size_t n = 1; n <= run_length + 1; ++n) {
+                auto ret = bit::find_run(bitvec.begin(), bitvec.end(), bit::bit0, n);
+                EXPECT_EQ(ret, n <= run_length ? bitvec.begin() + run_start : bitvec.end());
+            }
+            // The run is clipped by the end of the range
+            auto last = bitvec.begin() + run_start + run_length - 1;
+            EXPECT_EQ(bit::find_run(bitvec.begin(), last, bit::bit0, run_length), last);
+            EXPECT_EQ(bit::find_run(bitvec.begin(), bitvec.end(), bit::bit0, 0), bitvec.begin());
+        }
+    }
+}
@@ -0,0 +1,104 @@
+// =========================== ID ALLOCATOR TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for id_allocator
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <thread>
+#include <vector>
+// Project sources
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+template<typename WordType>
+class IdAllocatorTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    const size_t digits = bit::binary_digits<WordType>::value;
+};
+TYPED_TEST_SUITE(IdAllocatorTest, BaseTypes);
+
+TYPED_TEST(IdAllocatorTest, ExhaustAndRefill) {
+    using WordType = typename TestFixture::base_type;
+    for (bool use_summary : {false, true}) {
+        const size_t capacity = 7*this->digits + 5;
+        bit::id_allocator<WordType> alloc(capacity, use_summary, 3);
+        EXPECT_EQ(alloc.has_summary(), use_summary);
+        std::vector<size_t> ids;
+        for (size_t i = 0; i < capacity; ++i) {
+            const size_t id = alloc.allocate();
+            ASSERT_NE(id, alloc.npos);
+            EXPECT_LT(id, capacity);
+            EXPECT_TRUE(alloc.is_allocated(id));
+            ids.push_back(id);
+        }
+        EXPECT_EQ(alloc.allocate(), alloc.npos);
+        EXPECT_EQ(alloc.allocated(), capacity);
+        std::sort(ids.begin(), ids.end());
+        EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+
+        // Freed ids are found again, even in the middle of a full pool
+        for (size_t id : {size_t(0), capacity / 2, capacity - 1}) {
+            alloc.deallocate(id);
+            EXPECT_FALSE(alloc.is_allocated(id));
+        }
+        EXPECT_EQ(alloc.allocated(), capacity - 3);
+        std::vector<size_t> again;
+        for (size_t i = 0; i < 3; ++i) {
+            again.push_back(alloc.allocate());
+        }
+        std::sort(again.begin(), again.end());
+        EXPECT_EQ(again, (std::vector<size_t>{0, capacity / 2, capacity - 1}));
+        EXPECT_EQ(alloc.allocate(), alloc.npos);
+    }
+}
+
+TYPED_TEST(IdAllocatorTest, ConcurrentAllocateDeallocate) {
+    using WordType = typename TestFixture::base_type;
+    const size_t capacity = 1 << 12;
+    const unsigned int num_threads = 4;
+    const size_t per_thread = capacity / num_threads;
+    for (bool use_summary : {false, true}) {
+        bit::id_allocator<WordType> alloc(capacity, use_summary);
+        std::vector<std::vector<size_t>> owned(num_threads);
+        std::vector<std::thread> threads;
+        // Churn, then fill the pool completely between the threads
+        for (unsigned int t = 0; t < num_threads; ++t) {
+            threads.emplace_back([&alloc, &owned, per_thread, t]() {
+                for (size_t round = 0; round < 4; ++round) {
+                    for (size_t i = 0; i < per_thread; ++i) {
+                        owned[t].push_back(alloc.allocate());
+                    }
+                    if (round != 3) {
+                        for (size_t id : owned[t]) {
+                            alloc.deallocate(id);
+                        }
+                        owned[t].clear();
+                    }
+                }
+            });
+        }
+        for (auto& th : threads) {
+            th.join();
+        }
+        std::vector<size_t> all;
+        for (const auto& ids : owned) {
+            all.insert(all.end(), ids.begin(), ids.end());
+        }
+        std::sort(all.begin(), all.end());
+        EXPECT_EQ(all.size(), capacity);
+        EXPECT_EQ(std::count(all.begin(), all.end(), alloc.npos), 0);
+        EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+        EXPECT_EQ(alloc.allocated(), capacity);
+        EXPECT_EQ(alloc.allocate(), alloc.npos);
+    }
+}
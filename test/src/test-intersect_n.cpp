@@ -0,0 +1,116 @@
+// ============================ INTERSECT N TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the intersection of many bit ranges
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Sparse inputs of several chunks of words, starting anywhere in their words
+template<typename WordType>
+class IntersectNTest : public testing::Test {
+    protected:
+    using span_type = bit::bit_span<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    size_t length = 3 * 65536 + 77;
+    std::vector<std::vector<WordType>> words;
+    std::vector<span_type> inputs;
+
+    // Input i has about one bit in 2^sparsity[i] set
+    void make_inputs(const std::vector<size_t>& sparsity) {
+        words.clear();
+        inputs.clear();
+        for (size_t i = 0; i < sparsity.size(); ++i) {
+            words.push_back(std::vector<WordType>(length / digits + 2, static_cast<WordType>(-1)));
+            for (size_t s = 0; s < sparsity[i]; ++s) {
+                const auto random = get_random_vec<WordType>(words.back().size());
+                for (size_t j = 0; j < random.size(); ++j) {
+                    words.back()[j] &= random[j];
+                }
+            }
+            const size_t offset = i % 2 ? generate_random_number(0, digits - 1) : 0;
+            inputs.emplace_back(words.back().data(), offset, length);
+        }
+    }
+
+    // The intersection, bit by bit
+    std::vector<bool> expected() const {
+        std::vector<bool> result(length, true);
+        for (const auto& input : inputs) {
+            for (size_t j = 0; j < length; ++j) {
+                result[j] = result[j] && input[j] == bit::bit1;
+            }
+        }
+        return result;
+    }
+};
+TYPED_TEST_SUITE(IntersectNTest, BaseTypes);
+
+TYPED_TEST(IntersectNTest, Intersection) {
+    using WordType = TypeParam;
+    const std::vector<std::vector<size_t>> cases = {
+        {1}, {0, 1, 2}, {1, 1, 1, 1}, {3, 0, 4, 2, 1, 2, 3, 0, 0, 1, 2, 4}};
+    for (const auto& sparsity : cases) {
+        this->make_inputs(sparsity);
+        const auto expected = this->expected();
+        size_t ones = 0;
+        for (bool bit : expected) {
+            ones += bit;
+        }
+        for (size_t d_start : {size_t(0), size_t(3)}) {
+            bit::bit_vector<WordType> bitout(this->length + d_start + 5);
+            auto d_first = bitout.begin() + d_start;
+            EXPECT_EQ(bit::intersect_n(this->inputs, d_first), d_first + this->length);
+            std::vector<bool> expected_out(bitout.size(), false);
+            std::copy(expected.begin(), expected.end(), expected_out.begin() + d_start);
+            ASSERT_EQ(boolvec_from_bitvec(bitout), expected_out) << sparsity.size() << " " << d_start;
+        }
+        EXPECT_EQ(bit::intersect_count(this->inputs), ones) << sparsity.size();
+        EXPECT_EQ(bit::intersect_any(this->inputs), ones > 0) << sparsity.size();
+    }
+}
+
+TYPED_TEST(IntersectNTest, Existence) {
+    this->make_inputs({4, 4, 4, 4, 4, 4});
+    for (auto& input : this->inputs) {
+        bit::fill(input.begin(), input.end(), bit::bit0);
+    }
+    EXPECT_FALSE(bit::intersect_any(this->inputs));
+    EXPECT_EQ(bit::intersect_count(this->inputs), 0u);
+
+    // A single common bit in the last chunk of words
+    for (auto& input : this->inputs) {
+        input[this->length - 2] = bit::bit1;
+    }
+    EXPECT_TRUE(bit::intersect_any(this->inputs));
+    EXPECT_EQ(bit::intersect_count(this->inputs), 1u);
+}
+
+// The output may be any of the inputs, whichever order they are read in.
+// 11 words are fewer than a vector block, so every word is in the tail.
+TYPED_TEST(IntersectNTest, InPlace) {
+    for (size_t length : {this->length, 11 * this->digits}) {
+        this->length = length;
+        for (size_t i : {size_t(0), size_t(1), size_t(3)}) {
+            this->make_inputs({0, 3, 1, 2});
+            const auto expected = this->expected();
+            const auto out = this->inputs[i].begin();
+            EXPECT_EQ(bit::intersect_n(this->inputs, out), out + length);
+            for (size_t j = 0; j < length; ++j) {
+                ASSERT_EQ(out[j] == bit::bit1, expected[j]) << length << " " << i << " " << j;
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+// ============================== MISMATCH TESTS ============================ //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for mismatch and lexicographical_compare
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TYPED_TEST(DoubleRangeTest, Mismatch) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+        const bit::bit_vector<WordType>& bitvec1 = this->random_bitvecs1[idx];
+        const bit::bit_vector<WordType>& bitvec2 = this->random_bitvecs2[idx];
+        const std::vector<bool>& boolvec1 = this->random_boolvecs1[idx];
+        const std::vector<bool>& boolvec2 = this->random_boolvecs2[idx];
+        const size_t start1 = generate_random_number(0, std::min<size_t>(bitvec1.size(), digits + 1));
+        const size_t start2 = generate_random_number(0, std::min<size_t>(bitvec2.size(), digits + 1));
+        const size_t length1 = generate_random_number(0, bitvec1.size() - start1);
+        const size_t length2 = generate_random_number(0, bitvec2.size() - start2);
+        const size_t length = std::min(length1, length2);
+        auto first1 = bit::bit_iterator<const WordType*>(bitvec1.data()) + start1;
+        auto first2 = bit::bit_iterator<const WordType*>(bitvec2.data()) + start2;
+        auto bool_first1 = boolvec1.begin() + start1;
+        auto bool_first2 = boolvec2.begin() + start2;
+        const auto bool_mismatch = std::mismatch(bool_first1, bool_first1 + length, bool_first2);
+        const auto mismatch = bit::mismatch(first1, first1 + length, first2);
+        EXPECT_EQ(mismatch.first - first1, bool_mismatch.first - bool_first1);
+        EXPECT_EQ(mismatch.second - first2, bool_mismatch.second - bool_first2);
+        EXPECT_EQ(
+            bit::lexicographical_compare(first1, first1 + length1, first2, first2 + length2),
+            std::lexicographical_compare(
+                bool_first1, bool_first1 + length1, bool_first2, bool_first2 + length2));
+    }
+}
+
+// Long ranges that only differ in a single bit, at each end and in the
+// middle, for every combination of start positions
+TYPED_TEST(DoubleRangeTest, MismatchLong) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    const size_t length = 300 * digits + 3;
+    const auto words = get_random_vec<WordType>(302);
+    for (size_t start1 : {size_t(0), size_t(5)}) {
+        for (size_t start2 : {size_t(0), size_t(5), digits - 1}) {
+            bit::bit_vector<WordType> bitvec1(words.begin(), words.end());
+            bit::bit_vector<WordType> bitvec2(302 * digits);
+            auto first1 = bitvec1.begin() + start1;
+            auto first2 = bitvec2.begin() + start2;
+            bit::copy(first1, first1 + length, first2);
+            EXPECT_EQ(bit::mismatch(first1, first1 + length, first2).first, first1 + length);
+            EXPECT_FALSE(bit::lexicographical_compare(first1, first1 + length, first2, first2 + length));
+            EXPECT_TRUE(bit::lexicographical_compare(first1, first1 + length - 1, first2, first2 + length));
+            for (size_t i : {size_t(0), digits + 1, length / 2, length - 1}) {
+                first2[i] = ~first2[i];
+                const auto mismatch = bit::mismatch(first1, first1 + length, first2);
+                EXPECT_EQ(mismatch.first, first1 + i);
+                EXPECT_EQ(mismatch.second, first2 + i);
+                EXPECT_EQ(
+                    bit::lexicographical_compare(first1, first1 + length, first2, first2 + length),
+                    first1[i] == bit::bit0);
+                first2[i] = ~first2[i];
+            }
+        }
+    }
+}
@@ -0,0 +1,176 @@
+// =========================== MMAP BIT VECTOR TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the memory-mapped, file-backed bit vector
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <unistd.h>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Each test works on its own file in the temporary directory
+template<typename WordType>
+class MmapBitVectorTest : public testing::Test {
+    protected:
+    using vec_type = bit::mmap_bit_vector<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    std::string path;
+
+    void SetUp() override {
+        const auto* info = testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = std::string("bitlib-") + info->test_suite_name() + "-"
+            + info->name() + "-" + std::to_string(::getpid());
+        std::replace(name.begin(), name.end(), '/', '_');
+        path = (std::filesystem::temp_directory_path() / name).string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+};
+TYPED_TEST_SUITE(MmapBitVectorTest, BaseTypes);
+
+TYPED_TEST(MmapBitVectorTest, CreateAndReopen) {
+    using vec_type = typename TestFixture::vec_type;
+    const size_t n = 40*this->digits + 5;
+    std::vector<bool> expected(n);
+    {
+        vec_type vec(this->path, n);
+        EXPECT_TRUE(vec.is_open());
+        EXPECT_TRUE(vec.writable());
+        EXPECT_EQ(vec.size(), n);
+        EXPECT_EQ(bit::count(vec.begin(), vec.end(), bit::bit1), 0);
+        for (size_t i = 0; i < n; i += 3) {
+            vec[i] = bit::bit1;
+            expected[i] = true;
+        }
+        vec.sync();
+    }
+    EXPECT_EQ(std::filesystem::file_size(this->path), (40 + 1)*sizeof(TypeParam));
+
+    // The file only holds words, so the length is rounded up to a word
+    const vec_type vec(this->path);
+    EXPECT_FALSE(vec.writable());
+    EXPECT_EQ(vec.size(), 41*this->digits);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(vec[i] == bit::bit1, expected[i]) << i;
+    }
+    EXPECT_EQ(bit::count(vec.cbegin(), vec.cend(), bit::bit1),
+            std::count(expected.begin(), expected.end(), true));
+    EXPECT_THROW(vec.at(vec.size()), std::out_of_range);
+}
+
+TYPED_TEST(MmapBitVectorTest, Resize) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type vec(this->path, bit::mmap_mode::read_write);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(vec.data(), nullptr);
+
+    vec.resize(3*this->digits);
+    bit::fill(vec.begin(), vec.end(), bit::bit1);
+    // Shrinking within a word and growing again clears the old bits
+    vec.resize(2*this->digits + 1);
+    vec.resize(3*this->digits);
+    EXPECT_EQ(bit::count(vec.begin(), vec.end(), bit::bit1),
+            static_cast<std::ptrdiff_t>(2*this->digits + 1));
+
+    // Growing far past the first page, and shrinking down to nothing
+    const size_t big = 1 << 20;
+    vec.resize(big);
+    EXPECT_EQ(vec.size(), big);
+    EXPECT_EQ(bit::count(vec.begin(), vec.end(), bit::bit1),
+            static_cast<std::ptrdiff_t>(2*this->digits + 1));
+    vec[big - 1] = bit::bit1;
+    vec.resize(big / 2);
+    vec.resize(big);
+    EXPECT_EQ(vec[big - 1], bit::bit0);
+    EXPECT_EQ(std::filesystem::file_size(this->path), big / 8);
+    vec.resize(0);
+    EXPECT_TRUE(vec.empty());
+    EXPECT_EQ(std::filesystem::file_size(this->path), 0u);
+}
+
+// The bits cut off by a shrink within the last word are cleared in the file,
+// and read as 0 once it is reopened with its length rounded up to the word
+TYPED_TEST(MmapBitVectorTest, ShrinkAndReopen) {
+    using vec_type = typename TestFixture::vec_type;
+    const size_t n = 2*this->digits;
+    const size_t shrunk = this->digits + this->digits / 2 + 1;
+    {
+        vec_type vec(this->path, n);
+        bit::fill(vec.begin(), vec.end(), bit::bit1);
+        vec.resize(shrunk);
+        EXPECT_EQ(vec.size(), shrunk);
+    }
+    const vec_type vec(this->path);
+    EXPECT_EQ(vec.size(), n);
+    EXPECT_EQ(bit::count(vec.begin(), vec.end(), bit::bit1),
+            static_cast<std::ptrdiff_t>(shrunk));
+    EXPECT_EQ(bit::count(vec.begin() + shrunk, vec.end(), bit::bit1), 0);
+}
+
+TYPED_TEST(MmapBitVectorTest, Algorithms) {
+    using WordType = TypeParam;
+    using vec_type = typename TestFixture::vec_type;
+    const size_t n = 100*this->digits + 17;
+    auto words = get_random_vec<WordType>(101);
+    bit::bit_vector<WordType> reference(words.begin(), words.end());
+    reference.resize(n);
+
+    vec_type vec(this->path, n);
+    vec.advise(bit::mmap_advice::sequential);
+    vec.advise(bit::mmap_advice::hugepage);
+    vec.advise(bit::mmap_advice::normal);
+    bit::copy(reference.begin(), reference.end(), vec.begin());
+    EXPECT_TRUE(bit::equal(reference.begin(), reference.end(), vec.begin()));
+    EXPECT_EQ(bit::count(vec.begin(), vec.end(), bit::bit1),
+            bit::count(reference.begin(), reference.end(), bit::bit1));
+
+    bit::transform(vec.begin() + 3, vec.end(), vec.begin() + 3, std::bit_not<WordType>());
+    bit::transform(reference.begin() + 3, reference.end(), reference.begin() + 3,
+            std::bit_not<WordType>());
+    bit::shift_left(vec.begin() + 1, vec.end(), 2*this->digits + 1);
+    bit::shift_left(reference.begin() + 1, reference.end(), 2*this->digits + 1);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(vec[i], reference[i]) << i;
+    }
+
+    // Moves hand over the mapping
+    auto data = vec.data();
+    vec_type moved(std::move(vec));
+    EXPECT_FALSE(vec.is_open());
+    EXPECT_EQ(moved.data(), data);
+    vec = std::move(moved);
+    EXPECT_EQ(vec.data(), data);
+    EXPECT_EQ(vec.size(), n);
+}
+
+TYPED_TEST(MmapBitVectorTest, Errors) {
+    using vec_type = typename TestFixture::vec_type;
+    EXPECT_THROW(vec_type(this->path), std::system_error);
+    try {
+        vec_type vec(this->path + "/missing/file", bit::mmap_mode::read_write);
+        FAIL();
+    } catch (const std::system_error& e) {
+        EXPECT_EQ(e.code(), std::errc::no_such_file_or_directory);
+    }
+    { vec_type created(this->path, 10); }
+    vec_type read_only(this->path);
+    EXPECT_THROW(read_only.resize(100), std::system_error);
+}
@@ -0,0 +1,178 @@
+// =========================== SERIALIZATION TESTS ========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the binary format of bit vectors
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TEST(Xxh64Test, KnownValues) {
+    EXPECT_EQ(bit::xxh64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(bit::xxh64("a", 1), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(bit::xxh64("abc", 3), 0x44BC2CF5AD770999ULL);
+    const char* text = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(bit::xxh64(text, std::strlen(text)), 0xFBCEA83C8A378BF1ULL);
+}
+
+// Feeding the input in pieces gives the hash of the whole
+TEST(Xxh64Test, Stream) {
+    auto words = get_random_vec<std::uint8_t>(200);
+    for (size_t size : {size_t(0), size_t(7), size_t(31), size_t(32), size_t(100), size_t(200)}) {
+        for (size_t piece : {size_t(1), size_t(5), size_t(32), size_t(33)}) {
+            bit::_xxh64_stream stream(42);
+            for (size_t i = 0; i < size; i += piece) {
+                stream.update(words.data() + i, std::min(piece, size - i));
+            }
+            EXPECT_EQ(stream.digest(), bit::xxh64(words.data(), size, 42)) << size << " " << piece;
+        }
+    }
+}
+
+template<typename WordType>
+class SerializationTest : public testing::Test {
+    protected:
+    const size_t digits = bit::binary_digits<WordType>::value;
+
+    static std::string serialize(const bit::bit_vector<WordType>& bv) {
+        std::ostringstream os;
+        bit::save(os, bv);
+        return os.str();
+    }
+};
+TYPED_TEST_SUITE(SerializationTest, BaseTypes);
+
+TYPED_TEST(SerializationTest, RoundTrip) {
+    using WordType = TypeParam;
+    for (size_t n : {size_t(0), size_t(1), this->digits, 37*this->digits + 11}) {
+        auto words = get_random_vec<WordType>(n / this->digits + 1);
+        bit::bit_vector<WordType> bv(words.begin(), words.end());
+        bv.resize(n);
+        const std::string bytes = this->serialize(bv);
+        const size_t payload = (n + this->digits - 1) / this->digits * sizeof(WordType);
+        ASSERT_EQ(bytes.size(), bit::bit_format::header_size + payload);
+        EXPECT_EQ(bytes.compare(0, 8, bit::bit_format::magic.data(), 8), 0);
+
+        std::istringstream is(bytes);
+        auto loaded = bit::load<WordType>(is);
+        ASSERT_EQ(loaded.size(), n);
+        EXPECT_TRUE(bit::equal(loaded.begin(), loaded.end(), bv.begin()));
+
+        // Stale bits past the end do not change the output
+        if (n % this->digits != 0) {
+            bv.push_back(bit::bit1);
+            bv.pop_back();
+            EXPECT_EQ(this->serialize(bv), bytes);
+        }
+    }
+}
+
+TYPED_TEST(SerializationTest, View) {
+    using WordType = TypeParam;
+    const size_t n = 50*this->digits + 3;
+    auto words = get_random_vec<WordType>(51);
+    bit::bit_vector<WordType> bv(words.begin(), words.end());
+    bv.resize(n);
+    const std::string bytes = this->serialize(bv);
+
+    // The payload follows a 64-byte header, so an aligned buffer gives
+    // aligned words
+    std::vector<std::uint64_t> buffer(bytes.size() / sizeof(std::uint64_t) + 1);
+    std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    auto span = bit::view<WordType>(buffer.data(), bytes.size(), true);
+    static_assert(std::is_same_v<decltype(span), bit::bit_span<const WordType>>);
+    ASSERT_EQ(span.size(), n);
+    EXPECT_EQ(reinterpret_cast<const unsigned char*>(span.data()),
+            reinterpret_cast<const unsigned char*>(buffer.data()) + bit::bit_format::header_size);
+    EXPECT_TRUE(bit::equal(span.begin(), span.end(), bit::bit_span<const WordType>(bv.data(), n).begin()));
+
+    EXPECT_THROW(bit::view<WordType>(buffer.data(), bytes.size() - 1), bit::format_error);
+    EXPECT_THROW(bit::view<WordType>(reinterpret_cast<const char*>(buffer.data()) + 1, bytes.size()),
+            bit::format_error);
+}
+
+TYPED_TEST(SerializationTest, MappedFile) {
+    using WordType = TypeParam;
+    const size_t n = 1000*this->digits + 7;
+    auto words = get_random_vec<WordType>(1001);
+    bit::bit_vector<WordType> bv(words.begin(), words.end());
+    bv.resize(n);
+
+    std::string name = std::string("bitlib-serialization-")
+        + testing::UnitTest::GetInstance()->current_test_info()->name()
+        + "-" + std::to_string(::getpid());
+    std::replace(name.begin(), name.end(), '/', '_');
+    const std::string path = (std::filesystem::temp_directory_path() / name).string();
+    {
+        std::ofstream os(path, std::ios::binary);
+        bit::save(os, bv);
+    }
+    {
+        const bit::mmap_bit_vector<unsigned char> file(path);
+        auto span = bit::view<WordType>(file.data(), file.size() / 8);
+        ASSERT_EQ(span.size(), n);
+        EXPECT_EQ(bit::count(span.begin(), span.end(), bit::bit1),
+                bit::count(bv.begin(), bv.end(), bit::bit1));
+        EXPECT_TRUE(bit::equal(span.begin(), span.end(), bit::bit_span<const WordType>(bv.data(), n).begin()));
+    }
+    std::ifstream is(path, std::ios::binary);
+    auto loaded = bit::load<WordType>(is);
+    EXPECT_TRUE(bit::equal(loaded.begin(), loaded.end(), bv.begin()));
+    std::filesystem::remove(path);
+}
+
+TYPED_TEST(SerializationTest, Corruption) {
+    using WordType = TypeParam;
+    auto words = get_random_vec<WordType>(8);
+    bit::bit_vector<WordType> bv(words.begin(), words.end());
+    const std::string bytes = this->serialize(bv);
+
+    // Every single byte flip is caught, either by the header checks or by
+    // the payload checksum
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        std::string corrupt = bytes;
+        corrupt[i] = static_cast<char>(corrupt[i] ^ 0x10);
+        std::istringstream is(corrupt);
+        EXPECT_THROW(bit::load<WordType>(is), bit::format_error) << i;
+    }
+    std::istringstream truncated(bytes.substr(0, bytes.size() - 1));
+    EXPECT_THROW(bit::load<WordType>(truncated), bit::format_error);
+    std::istringstream empty;
+    EXPECT_THROW(bit::load<WordType>(empty), bit::format_error);
+
+    // A larger header whose padding is cut short
+    bit::bit_format_header header;
+    header.word_bits = static_cast<std::uint8_t>(this->digits);
+    header.header_size = 2 * bit::bit_format::header_size;
+    const auto header_bytes = bit::_encode_header(header);
+    std::string padded(reinterpret_cast<const char*>(header_bytes.data()), header_bytes.size());
+    std::istringstream short_padding(padded + std::string(10, '\0'));
+    EXPECT_THROW(bit::load<WordType>(short_padding), bit::format_error);
+    std::istringstream full_padding(padded + std::string(bit::bit_format::header_size, '\0'));
+    EXPECT_TRUE(bit::load<WordType>(full_padding).empty());
+
+    // Words of another width are rejected
+    bit::bit_vector<std::conditional_t<sizeof(WordType) == 1, std::uint16_t, std::uint8_t>> other(10);
+    std::ostringstream os;
+    bit::save(os, other);
+    std::istringstream is(os.str());
+    EXPECT_THROW(bit::load<WordType>(is), bit::format_error);
+}
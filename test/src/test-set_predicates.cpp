@@ -0,0 +1,107 @@
+// =========================== SET PREDICATES TESTS ========================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the subset, disjointness and emptiness tests
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TYPED_TEST(DoubleRangeTest, SetPredicates) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+        const bit::bit_vector<WordType>& bitvec1 = this->random_bitvecs1[idx];
+        const bit::bit_vector<WordType>& bitvec2 = this->random_bitvecs2[idx];
+        const std::vector<bool>& boolvec1 = this->random_boolvecs1[idx];
+        const std::vector<bool>& boolvec2 = this->random_boolvecs2[idx];
+        const size_t start1 = generate_random_number(0, std::min<size_t>(bitvec1.size(), digits + 1));
+        const size_t start2 = generate_random_number(0, std::min<size_t>(bitvec2.size(), digits + 1));
+        const size_t length = generate_random_number(0, std::min(bitvec1.size() - start1, bitvec2.size() - start2));
+        bool subset = true;
+        bool disjoint = true;
+        for (size_t i = 0; i < length; ++i) {
+            subset = subset && (!boolvec1[start1 + i] || boolvec2[start2 + i]);
+            disjoint = disjoint && !(boolvec1[start1 + i] && boolvec2[start2 + i]);
+        }
+        auto first1 = bit::bit_iterator<const WordType*>(bitvec1.data()) + start1;
+        auto first2 = bit::bit_iterator<const WordType*>(bitvec2.data()) + start2;
+        EXPECT_EQ(bit::is_subset_of(first1, first1 + length, first2), subset);
+        EXPECT_EQ(bit::is_disjoint(first1, first1 + length, first2), disjoint);
+        EXPECT_EQ(bit::intersects(first1, first1 + length, first2), !disjoint);
+    }
+}
+
+// Long ranges that only differ in a single bit, at each end and in the
+// middle, for every combination of start positions
+TYPED_TEST(DoubleRangeTest, SetPredicatesLong) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    const size_t length = 300 * digits + 3;
+    const auto words = get_random_vec<WordType>(302);
+    for (size_t start1 : {size_t(0), size_t(5)}) {
+        for (size_t start2 : {size_t(0), size_t(5), digits - 1}) {
+            bit::bit_vector<WordType> bitvec1(words.begin(), words.end());
+            bit::bit_vector<WordType> bitvec2(302 * digits, bit::bit1);
+            bit::bit_vector<WordType> bitvec3(302 * digits, bit::bit0);
+            for (size_t i = 0; i < length; ++i) {
+                bitvec3[start2 + i] = ~bitvec1[start1 + i];
+            }
+            auto first1 = bitvec1.begin() + start1;
+            auto first2 = bitvec2.begin() + start2;
+            auto first3 = bitvec3.begin() + start2;
+            EXPECT_TRUE(bit::is_subset_of(first1, first1 + length, first2));
+            EXPECT_TRUE(bit::is_disjoint(first1, first1 + length, first3));
+            EXPECT_FALSE(bit::intersects(first1, first1 + length, first3));
+            for (size_t i : {size_t(0), length / 2, length - 1}) {
+                const bit::bit_value value = first1[i];
+                first1[i] = bit::bit1;
+                first2[i] = bit::bit0;
+                EXPECT_FALSE(bit::is_subset_of(first1, first1 + length, first2)) << i;
+                first2[i] = bit::bit1;
+                first3[i] = bit::bit1;
+                EXPECT_FALSE(bit::is_disjoint(first1, first1 + length, first3)) << i;
+                EXPECT_TRUE(bit::intersects(first1, first1 + length, first3)) << i;
+                first1[i] = value;
+                first3[i] = ~value;
+            }
+        }
+    }
+}
+
+TYPED_TEST(VectorTest, AnyAllNone) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    const size_t length = 100 * digits + 3;
+    for (size_t start : {size_t(0), size_t(3)}) {
+        bit::bit_vector<WordType> bitvec(start + length, bit::bit0);
+        auto first = bitvec.begin() + start;
+        auto last = first + length;
+        EXPECT_FALSE(bit::any(first, last));
+        EXPECT_FALSE(bit::all(first, last));
+        EXPECT_TRUE(bit::none(first, last));
+        EXPECT_TRUE(bit::all(first, first));
+        EXPECT_TRUE(bit::none(first, first));
+        first[length - 1] = bit::bit1;
+        EXPECT_TRUE(bit::any(first, last));
+        EXPECT_FALSE(bit::none(first, last));
+        EXPECT_FALSE(bit::any(first, last - 1));
+        bit::fill(first, last, bit::bit1);
+        EXPECT_TRUE(bit::all(first, last));
+        first[0] = bit::bit0;
+        EXPECT_FALSE(bit::all(first, last));
+        EXPECT_TRUE(bit::all(first + 1, last));
+    }
+}
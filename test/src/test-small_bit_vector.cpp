@@ -0,0 +1,285 @@
+// ========================== SMALL BIT VECTOR TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the small-buffer-optimized bit vector
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+namespace {
+// Counts the words allocated through it, to check that small vectors stay
+// off the heap
+std::size_t allocated_words = 0;
+
+template <class T>
+struct counting_allocator : std::allocator<T> {
+    using value_type = T;
+    template <class U>
+    struct rebind {using other = counting_allocator<U>;};
+    counting_allocator() = default;
+    template <class U>
+    counting_allocator(const counting_allocator<U>&) {}
+    T* allocate(std::size_t n) {
+        allocated_words += n;
+        return std::allocator<T>::allocate(n);
+    }
+};
+
+// Stateful and not propagated on move assignment: words must be freed
+// through the arena that allocated them
+std::ptrdiff_t arena_words[2] = {0, 0};
+
+template <class T>
+struct arena_allocator : std::allocator<T> {
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::false_type;
+    using is_always_equal = std::false_type;
+    template <class U>
+    struct rebind {using other = arena_allocator<U>;};
+    int arena;
+    explicit arena_allocator(int arena_) : arena(arena_) {}
+    template <class U>
+    arena_allocator(const arena_allocator<U>& other) : arena(other.arena) {}
+    T* allocate(std::size_t n) {
+        arena_words[arena] += n;
+        return std::allocator<T>::allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        arena_words[arena] -= n;
+        std::allocator<T>::deallocate(p, n);
+    }
+    bool operator==(const arena_allocator& other) const {return arena == other.arena;}
+    bool operator!=(const arena_allocator& other) const {return arena != other.arena;}
+};
+
+template <class Vector>
+std::vector<bool> to_boolvec(const Vector& vec) {
+    std::vector<bool> ret;
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        ret.push_back(vec[i] == bit::bit1);
+    }
+    return ret;
+}
+} // namespace
+
+// Two inline words, so that a handful of operations move the bits between
+// the inline buffer and the heap
+template<typename WordType>
+class SmallBitVectorTest : public testing::Test {
+    protected:
+    using base_type = WordType;
+    using vec_type = bit::small_bit_vector<WordType, 2>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    const size_t inline_bits = 2*digits;
+};
+TYPED_TEST_SUITE(SmallBitVectorTest, BaseTypes);
+
+TYPED_TEST(SmallBitVectorTest, Construction) {
+    using vec_type = typename TestFixture::vec_type;
+    using WordType = TypeParam;
+    vec_type empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.is_inline());
+    EXPECT_EQ(empty.capacity(), this->inline_bits);
+
+    for (size_t n : {size_t(0), size_t(3), this->inline_bits, this->inline_bits + 1, 5*this->digits}) {
+        vec_type ones(n, bit::bit1);
+        EXPECT_EQ(ones.size(), n);
+        EXPECT_EQ(ones.is_inline(), n <= this->inline_bits);
+        EXPECT_EQ(bit::count(ones.begin(), ones.end(), bit::bit1), static_cast<std::ptrdiff_t>(n));
+        vec_type zeros(n);
+        EXPECT_EQ(bit::count(zeros.begin(), zeros.end(), bit::bit0), static_cast<std::ptrdiff_t>(n));
+    }
+
+    auto words = get_random_vec<WordType>(3);
+    vec_type from_words(words.begin(), words.end());
+    EXPECT_EQ(from_words.size(), 3*this->digits);
+    EXPECT_FALSE(from_words.is_inline());
+    EXPECT_TRUE(bit::equal(from_words.begin(), from_words.end(),
+            bit::bit_iterator<WordType*>(words.data())));
+
+    std::vector<bool> bools{true, false, true, true};
+    EXPECT_EQ(to_boolvec(vec_type(bools.begin(), bools.end())), bools);
+    EXPECT_EQ(to_boolvec(vec_type{true, false, true, true}), bools);
+    EXPECT_EQ(to_boolvec(vec_type{bit::bit1, bit::bit0, bit::bit1, bit::bit1}), bools);
+    EXPECT_EQ(to_boolvec(vec_type("10 11")), bools);
+    auto word_bools = to_boolvec(from_words);
+    word_bools.resize(this->digits + 3);
+    EXPECT_EQ(to_boolvec(vec_type(from_words.begin(), from_words.begin() + this->digits + 3)),
+            word_bools);
+}
+
+TYPED_TEST(SmallBitVectorTest, Access) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type vec("0110");
+    EXPECT_EQ(vec.front(), bit::bit0);
+    EXPECT_EQ(vec[1], bit::bit1);
+    EXPECT_EQ(vec.back(), bit::bit0);
+    EXPECT_THROW(vec.at(4), std::out_of_range);
+    vec.at(3) = bit::bit1;
+    const vec_type& cvec = vec;
+    EXPECT_EQ(cvec.back(), bit::bit1);
+    EXPECT_EQ(cvec.at(3), bit::bit1);
+    EXPECT_THROW(cvec.at(4), std::out_of_range);
+    EXPECT_EQ(cvec.end() - cvec.begin(), 4);
+    EXPECT_EQ(bit::count(cvec.cbegin(), cvec.cend(), bit::bit1), 3);
+}
+
+// Random operations against std::vector<bool>, crossing the inline capacity
+// in both directions
+TYPED_TEST(SmallBitVectorTest, Modifiers) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type vec;
+    std::vector<bool> ref;
+    for (int step = 0; step < 400; ++step) {
+        const auto op = generate_random_number(0, 6);
+        const size_t pos = generate_random_number(0, ref.size());
+        const bool b = generate_random_number(0, 1);
+        if (op == 0 || ref.empty()) {
+            vec.push_back(bit::bit_value(b));
+            ref.push_back(b);
+        } else if (op == 1) {
+            vec.pop_back();
+            ref.pop_back();
+        } else if (op == 2) {
+            auto ret = vec.insert(vec.cbegin() + pos, bit::bit_value(b));
+            ref.insert(ref.begin() + pos, b);
+            EXPECT_EQ(ret, vec.begin() + pos);
+        } else if (op == 3) {
+            const size_t count = generate_random_number(0, 2*this->digits);
+            vec.insert(vec.cbegin() + pos, count, bit::bit_value(b));
+            ref.insert(ref.begin() + pos, count, b);
+        } else if (op == 4) {
+            const size_t last = generate_random_number(pos, ref.size());
+            auto ret = vec.erase(vec.begin() + pos, vec.begin() + last);
+            ref.erase(ref.begin() + pos, ref.begin() + last);
+            EXPECT_EQ(ret - vec.begin(), static_cast<std::ptrdiff_t>(pos));
+        } else if (op == 5 && pos < ref.size()) {
+            vec.erase(vec.begin() + pos);
+            ref.erase(ref.begin() + pos);
+        } else {
+            const size_t n = generate_random_number(0, 3*this->digits);
+            vec.resize(n, bit::bit_value(b));
+            ref.resize(n, b);
+        }
+        ASSERT_EQ(to_boolvec(vec), ref);
+    }
+
+    auto other = vec_type(3*this->digits, bit::bit1);
+    vec.resize(5);
+    ref.resize(5);
+    vec.insert(vec.cbegin() + 2, other.begin(), other.end());
+    ref.insert(ref.begin() + 2, 3*this->digits, true);
+    EXPECT_EQ(to_boolvec(vec), ref);
+    vec.resize(vec.size() + 7);
+    ref.resize(ref.size() + 7);
+    EXPECT_EQ(to_boolvec(vec), ref);
+
+    vec.clear();
+    EXPECT_TRUE(vec.empty());
+    EXPECT_FALSE(vec.is_inline());
+    vec.shrink_to_fit();
+    EXPECT_TRUE(vec.is_inline());
+    vec.reserve(4*this->digits);
+    EXPECT_GE(vec.capacity(), 4*this->digits);
+    EXPECT_FALSE(vec.is_inline());
+}
+
+TYPED_TEST(SmallBitVectorTest, CopyMoveSwap) {
+    using vec_type = typename TestFixture::vec_type;
+    vec_type small("1011");
+    vec_type big(3*this->digits + 1, bit::bit0);
+    big[this->digits] = bit::bit1;
+    const auto small_bools = to_boolvec(small);
+    const auto big_bools = to_boolvec(big);
+
+    vec_type small_copy(small);
+    vec_type big_copy(big);
+    EXPECT_EQ(to_boolvec(small_copy), small_bools);
+    EXPECT_EQ(to_boolvec(big_copy), big_bools);
+    EXPECT_NE(big_copy.data(), big.data());
+
+    const auto big_data = big.data();
+    vec_type big_moved(std::move(big));
+    EXPECT_EQ(big_moved.data(), big_data);
+    EXPECT_TRUE(big.empty());
+    EXPECT_TRUE(big.is_inline());
+    vec_type small_moved(std::move(small));
+    EXPECT_EQ(to_boolvec(small_moved), small_bools);
+    EXPECT_TRUE(small_moved.is_inline());
+
+    small_copy = big_copy;
+    EXPECT_EQ(to_boolvec(small_copy), big_bools);
+    big_copy = small_moved;
+    EXPECT_EQ(to_boolvec(big_copy), small_bools);
+    small_copy = std::move(big_moved);
+    EXPECT_EQ(to_boolvec(small_copy), big_bools);
+    EXPECT_EQ(small_copy.data(), big_data);
+    big_moved = std::move(small_moved);
+    EXPECT_EQ(to_boolvec(big_moved), small_bools);
+
+    swap(small_copy, big_moved);
+    EXPECT_EQ(to_boolvec(small_copy), small_bools);
+    EXPECT_EQ(to_boolvec(big_moved), big_bools);
+    EXPECT_TRUE(small_copy.is_inline());
+    EXPECT_EQ(big_moved.data(), big_data);
+}
+
+TYPED_TEST(SmallBitVectorTest, NoAllocationWhileInline) {
+    using WordType = TypeParam;
+    using vec_type = bit::small_bit_vector<WordType, 2, counting_allocator<WordType>>;
+    allocated_words = 0;
+    vec_type vec;
+    for (size_t i = 0; i < this->inline_bits; ++i) {
+        vec.insert(vec.cbegin(), bit::bit_value(i % 3 == 0));
+    }
+    vec_type copy(vec);
+    copy.erase(copy.begin(), copy.begin() + 3);
+    EXPECT_EQ(allocated_words, 0u);
+    vec.push_back(bit::bit1);
+    EXPECT_EQ(allocated_words, 4u);
+}
+
+TYPED_TEST(SmallBitVectorTest, MoveAssignmentAllocators) {
+    using WordType = TypeParam;
+    using alloc_type = arena_allocator<WordType>;
+    using vec_type = bit::small_bit_vector<WordType, 2, alloc_type>;
+    static_assert(!std::is_nothrow_move_assignable<vec_type>::value, "");
+    {
+        vec_type dst(alloc_type(0));
+        vec_type src(4*this->digits + 1, bit::bit1, alloc_type(1));
+        src[3] = bit::bit0;
+        const auto bools = to_boolvec(src);
+        const auto src_data = src.data();
+
+        // Different arenas: the words are copied into dst's own arena
+        dst = std::move(src);
+        EXPECT_EQ(to_boolvec(dst), bools);
+        EXPECT_NE(dst.data(), src_data);
+        EXPECT_GT(arena_words[0], 0);
+
+        // Same arena: the buffer is stolen
+        vec_type same(alloc_type(0));
+        const auto dst_data = dst.data();
+        same = std::move(dst);
+        EXPECT_EQ(same.data(), dst_data);
+        EXPECT_EQ(to_boolvec(same), bools);
+    }
+    EXPECT_EQ(arena_words[0], 0);
+    EXPECT_EQ(arena_words[1], 0);
+}
@@ -105,3 +105,61 @@ TYPED_TEST(DoubleRangeTest, TransformBinaryOp) {
     }
 }
 
+
+TYPED_TEST(DoubleRangeTest, TransformBinaryOpLong) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    auto words1 = get_random_vec<WordType>(300);
+    auto words2 = get_random_vec<WordType>(300);
+    const size_t length = 280 * digits + 3;
+    auto xnor = [](WordType a, WordType b) {return static_cast<WordType>(a ^ ~b);};
+    for (size_t start1 : {size_t(0), size_t(5)}) {
+        for (size_t start2 : {size_t(0), size_t(5), digits - 1}) {
+            for (size_t d_start : {size_t(0), size_t(3)}) {
+                bit::bit_vector<WordType> bitvec1(words1.begin(), words1.end());
+                bit::bit_vector<WordType> bitvec2(words2.begin(), words2.end());
+                const auto boolvec1 = boolvec_from_bitvec(bitvec1);
+                const auto boolvec2 = boolvec_from_bitvec(bitvec2);
+                bit::bit_vector<WordType> bitout(bitvec1.size());
+                auto boolout = boolvec_from_bitvec(bitout);
+
+                // Standard bitwise operation
+                bit::transform(
+                        bitvec1.begin() + start1,
+                        bitvec1.begin() + start1 + length,
+                        bitvec2.begin() + start2,
+                        bitout.begin() + d_start,
+                        bit::bit_andnot<WordType>());
+                for (size_t i = 0; i < length; ++i) {
+                    boolout[d_start + i] = boolvec1[start1 + i] && !boolvec2[start2 + i];
+                }
+                EXPECT_EQ(boolvec_from_bitvec(bitout), boolout);
+
+                // Any other operation
+                bit::transform(
+                        bitvec1.begin() + start1,
+                        bitvec1.begin() + start1 + length,
+                        bitvec2.begin() + start2,
+                        bitout.begin() + d_start,
+                        xnor);
+                for (size_t i = 0; i < length; ++i) {
+                    boolout[d_start + i] = boolvec1[start1 + i] == boolvec2[start2 + i];
+                }
+                EXPECT_EQ(boolvec_from_bitvec(bitout), boolout);
+
+                // Destination before the second source in the same vector
+                bit::transform(
+                        bitvec1.begin() + start1,
+                        bitvec1.begin() + start1 + length,
+                        bitvec2.begin() + start2 + digits,
+                        bitvec2.begin() + d_start,
+                        std::bit_or<WordType>());
+                auto expected = boolvec2;
+                for (size_t i = 0; i < length; ++i) {
+                    expected[d_start + i] = boolvec1[start1 + i] || boolvec2[start2 + digits + i];
+                }
+                EXPECT_EQ(boolvec_from_bitvec(bitvec2), expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+// ========================== TRANSFORM ASSIGN TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the in place combination of bit ranges
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+TYPED_TEST(DoubleRangeTest, TransformAssign) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    const auto bool_ops = {
+        +[](bool a, bool b) {return a && b;},
+        +[](bool a, bool b) {return a || b;},
+        +[](bool a, bool b) {return a != b;},
+        +[](bool a, bool b) {return a && !b;}};
+    for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+        for (int op = 0; op < 4; ++op) {
+            bit::bit_vector<WordType>& bitvec1 = this->random_bitvecs1[idx];
+            bit::bit_vector<WordType>& bitvec2 = this->random_bitvecs2[idx];
+            std::vector<bool>& boolvec1 = this->random_boolvecs1[idx];
+            std::vector<bool>& boolvec2 = this->random_boolvecs2[idx];
+            if (bitvec1.empty() || bitvec2.empty()) {
+                continue;
+            }
+            const size_t start1 = generate_random_number(0, std::min<size_t>(bitvec1.size() - 1, digits + 1));
+            const size_t start2 = generate_random_number(0, std::min<size_t>(bitvec2.size() - 1, digits + 1));
+            const size_t length = generate_random_number(0, std::min(bitvec1.size() - start1, bitvec2.size() - start2));
+            auto first = bitvec1.begin() + start1;
+            auto s_first = bitvec2.begin() + start2;
+            auto ret = first;
+            switch (op) {
+                case 0: ret = bit::transform_assign(first, first + length, s_first, std::bit_and<WordType>()); break;
+                case 1: ret = bit::transform_assign(first, first + length, s_first, std::bit_or<WordType>()); break;
+                case 2: ret = bit::transform_assign(first, first + length, s_first, std::bit_xor<WordType>()); break;
+                default: ret = bit::transform_assign(first, first + length, s_first, bit::bit_andnot<WordType>()); break;
+            }
+            for (size_t i = 0; i < length; ++i) {
+                boolvec1[start1 + i] = (*(bool_ops.begin() + op))(boolvec1[start1 + i], boolvec2[start2 + i]);
+            }
+            EXPECT_EQ(ret, first + length);
+            EXPECT_TRUE(std::equal(
+                        bitvec1.begin(), bitvec1.end(),
+                        boolvec1.begin(), boolvec1.end(), comparator));
+            EXPECT_TRUE(std::equal(
+                        bitvec2.begin(), bitvec2.end(),
+                        boolvec2.begin(), boolvec2.end(), comparator));
+        }
+    }
+}
+
+TYPED_TEST(DoubleRangeTest, TransformAssignSelf) {
+    using WordType = typename TestFixture::base_type;
+    for (size_t idx = 0; idx < this->random_bitvecs1.size(); ++idx) {
+        bit::bit_vector<WordType>& bitvec = this->random_bitvecs1[idx];
+        const size_t start = generate_random_number(0, bitvec.size());
+        bit::transform_assign(bitvec.begin() + start, bitvec.end(), bitvec.begin() + start, bit::bit_andnot<WordType>());
+        EXPECT_EQ(bit::count(bitvec.begin() + start, bitvec.end(), bit::bit1), 0);
+    }
+}
+
+TYPED_TEST(DoubleRangeTest, TransformAssignLong) {
+    using WordType = typename TestFixture::base_type;
+    constexpr auto digits = bit::binary_digits<WordType>::value;
+    auto words1 = get_random_vec<WordType>(300);
+    auto words2 = get_random_vec<WordType>(300);
+    for (size_t start1 : {size_t(0), size_t(5)}) {
+        for (size_t start2 : {size_t(0), size_t(5), digits - 1}) {
+            bit::bit_vector<WordType> bitvec1(words1.begin(), words1.end());
+            const bit::bit_vector<WordType> bitvec2(words2.begin(), words2.end());
+            auto boolvec1 = boolvec_from_bitvec(bitvec1);
+            const auto boolvec2 = boolvec_from_bitvec(bitvec2);
+            const size_t length = 280 * digits + 3;
+            bit::transform_assign(
+                    bitvec1.begin() + start1,
+                    bitvec1.begin() + start1 + length,
+                    bit::bit_iterator<const WordType*>(bitvec2.data()) + start2,
+                    std::bit_xor<WordType>());
+            for (size_t i = 0; i < length; ++i) {
+                boolvec1[start1 + i] = boolvec1[start1 + i] != boolvec2[start2 + i];
+            }
+            EXPECT_EQ(boolvec_from_bitvec(bitvec1), boolvec1);
+        }
+    }
+}
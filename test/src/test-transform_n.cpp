@@ -0,0 +1,152 @@
+// ============================ TRANSFORM N TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for word operations over many bit ranges
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <functional>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Inputs span several blocks of words, and start anywhere in their words
+template<typename WordType>
+class TransformNTest : public testing::Test {
+    protected:
+    using span_type = bit::bit_span<WordType>;
+    const size_t digits = bit::binary_digits<WordType>::value;
+    size_t length = 2 * 4096 + 77;
+    std::vector<std::vector<WordType>> words;
+    std::vector<span_type> inputs;
+    std::vector<std::vector<bool>> boolvecs;
+
+    void make_inputs(size_t k) {
+        words.clear();
+        inputs.clear();
+        boolvecs.clear();
+        for (size_t i = 0; i < k; ++i) {
+            words.push_back(get_random_vec<WordType>(length / digits + 2));
+            const size_t offset = i == 0 ? 0 : generate_random_number(0, digits - 1);
+            inputs.emplace_back(words.back().data(), offset, length);
+            std::vector<bool> boolvec;
+            for (auto it = inputs.back().begin(); it != inputs.back().end(); ++it) {
+                boolvec.push_back(*it == bit::bit1);
+            }
+            boolvecs.push_back(boolvec);
+        }
+    }
+
+    // Number of inputs with bit j set
+    size_t ones(size_t j) const {
+        size_t count = 0;
+        for (const auto& boolvec : boolvecs) {
+            count += boolvec[j];
+        }
+        return count;
+    }
+};
+TYPED_TEST_SUITE(TransformNTest, BaseTypes);
+
+TYPED_TEST(TransformNTest, Operations) {
+    using WordType = TypeParam;
+    auto first_and_not_last = [](const WordType* words, size_t k) {
+        return static_cast<WordType>(words[0] & ~words[k - 1]);
+    };
+    for (size_t k : {size_t(1), size_t(3), size_t(7)}) {
+        this->make_inputs(k);
+        for (size_t d_start : {size_t(0), size_t(3)}) {
+            for (int op = 0; op < 6; ++op) {
+                bit::bit_vector<WordType> bitout(this->length + d_start + 5);
+                auto d_first = bitout.begin() + d_start;
+                auto ret = d_first;
+                switch (op) {
+                    case 0: ret = bit::transform_n(this->inputs, d_first, bit::bit_and_all()); break;
+                    case 1: ret = bit::transform_n(this->inputs, d_first, bit::bit_or_all()); break;
+                    case 2: ret = bit::transform_n(this->inputs, d_first, bit::bit_xor_all()); break;
+                    case 3: ret = bit::transform_n(this->inputs, d_first, bit::bit_at_least(3)); break;
+                    case 4: ret = bit::transform_n(this->inputs, d_first, bit::bit_majority()); break;
+                    default: ret = bit::transform_n(this->inputs, d_first, first_and_not_last); break;
+                }
+                EXPECT_EQ(ret, d_first + this->length);
+                std::vector<bool> expected(bitout.size(), false);
+                for (size_t j = 0; j < this->length; ++j) {
+                    const size_t ones = this->ones(j);
+                    bool value;
+                    switch (op) {
+                        case 0: value = ones == k; break;
+                        case 1: value = ones > 0; break;
+                        case 2: value = ones % 2 == 1; break;
+                        case 3: value = ones >= 3; break;
+                        case 4: value = ones > k / 2; break;
+                        default: value = this->boolvecs[0][j] && !this->boolvecs[k - 1][j]; break;
+                    }
+                    expected[d_start + j] = value;
+                }
+                ASSERT_EQ(boolvec_from_bitvec(bitout), expected) << k << " " << d_start << " " << op;
+            }
+        }
+    }
+}
+
+TYPED_TEST(TransformNTest, Threshold) {
+    using WordType = TypeParam;
+    const size_t k = 9;
+    this->make_inputs(k);
+    for (size_t threshold = 0; threshold <= k + 1; ++threshold) {
+        bit::bit_vector<WordType> bitout(this->length);
+        bit::transform_n(this->inputs, bitout.begin(), bit::bit_at_least(threshold));
+        for (size_t j = 0; j < this->length; ++j) {
+            ASSERT_EQ(bitout[j] == bit::bit1, this->ones(j) >= threshold) << threshold << " " << j;
+        }
+    }
+}
+
+TYPED_TEST(TransformNTest, InPlace) {
+    using WordType = TypeParam;
+    this->make_inputs(4);
+    bit::transform_n(this->inputs, this->inputs[0].begin(), bit::bit_or_all());
+    for (size_t j = 0; j < this->length; ++j) {
+        ASSERT_EQ(this->inputs[0][j] == bit::bit1, this->ones(j) > 0) << j;
+    }
+
+    // Into an input other than the first one, whose words are read after
+    // the first row has been combined, for each kind of block operation.
+    // 11 words are fewer than a vector block, so every word is in the tail.
+    this->length = 11 * this->digits;
+    for (size_t i : {size_t(1), size_t(3)}) {
+        for (int op = 0; op < 3; ++op) {
+            this->make_inputs(4);
+            const auto out = this->inputs[i].begin();
+            if (op == 0) {
+                bit::transform_n(this->inputs, out, bit::bit_xor_all());
+            } else if (op == 1) {
+                bit::transform_n(this->inputs, out, bit::bit_and_all());
+            } else {
+                bit::transform_n(this->inputs, out, bit::bit_at_least(2));
+            }
+            for (size_t j = 0; j < this->length; ++j) {
+                const size_t ones = this->ones(j);
+                const bool expected = op == 0 ? ones % 2 == 1 : op == 1 ? ones == 4 : ones >= 2;
+                ASSERT_EQ(out[j] == bit::bit1, expected) << i << " " << op << " " << j;
+            }
+        }
+    }
+
+    // Short ranges only touch partial words
+    std::vector<WordType> word(1, WordType(0));
+    std::vector<bit::bit_span<WordType>> inputs(2, bit::bit_span<WordType>(word.data(), 1, 2));
+    bit::bit_vector<WordType> bitout(4, bit::bit1);
+    EXPECT_EQ(bit::transform_n(inputs, bitout.begin() + 1, bit::bit_and_all()), bitout.begin() + 3);
+    EXPECT_EQ(boolvec_from_bitvec(bitout), std::vector<bool>({true, false, false, true}));
+}
@@ -0,0 +1,137 @@
+// ========================== UNIVERSAL CODES TESTS ========================= //
+// Project:         The Experimental Bit Algorithms Library
+// Description:     Tests for the gamma, delta, Rice and exp-Golomb codes
+// Contributor(s):  Bryce Kille
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+// Project sources
+#include "bitlib/bit-algorithms/bit_algorithm.hpp"
+#include "bitlib/bit-containers/bit-containers.hpp"
+#include "fixtures.hpp"
+// Third-party libraries
+#include "gtest/gtest.h"
+// Miscellaneous
+// ========================================================================== //
+
+// Values spread over every magnitude, from 1 up to the largest one
+inline std::vector<std::uint64_t> make_code_values(std::uint64_t max_value) {
+    std::vector<std::uint64_t> values = {1, 2, 3, 4, 5, 7, 8, max_value};
+    for (int i = 0; i < 1000; ++i) {
+        const unsigned int bits = generate_random_number(0, 63);
+        const std::uint64_t value = generate_random_number(
+                std::uint64_t(0), std::numeric_limits<std::uint64_t>::max()) >> bits;
+        values.push_back(std::max<std::uint64_t>(1, std::min(value, max_value)));
+    }
+    return values;
+}
+
+template<typename WordType>
+class UniversalCodesTest : public testing::Test {
+    protected:
+    template <class Code>
+    void check_round_trip(const Code& code, const std::vector<std::uint64_t>& values) {
+        bit::bit_vector<WordType> bv;
+        size_t expected_size = 0;
+        {
+            bit::bit_writer<WordType> writer(bv);
+            bit::encode(writer, values.begin(), values.end(), code);
+            for (auto value : values) {
+                expected_size += code.length(value);
+            }
+        }
+        EXPECT_EQ(bv.size(), expected_size);
+
+        bit::bit_reader<WordType> reader(bv);
+        std::vector<std::uint64_t> decoded(values.size());
+        auto end = bit::decode_n(reader, decoded.begin(), values.size(), code);
+        EXPECT_EQ(end, decoded.end());
+        EXPECT_EQ(decoded, values);
+        EXPECT_TRUE(reader.empty());
+        EXPECT_THROW(code.decode(reader), std::out_of_range);
+    }
+};
+TYPED_TEST_SUITE(UniversalCodesTest, BaseTypes);
+
+TYPED_TEST(UniversalCodesTest, Layout) {
+    using WordType = TypeParam;
+    // Textbook gamma codes for 1 to 4: 1, 010, 011, 00100
+    bit::bit_vector<WordType> bv;
+    {
+        bit::bit_writer<WordType> writer(bv);
+        for (std::uint64_t value = 1; value <= 4; ++value) {
+            bit::gamma_code().encode(writer, value);
+        }
+        bit::rice_code{2}.encode(writer, 9);
+        bit::exp_golomb_code{0}.encode(writer, 0);
+    }
+    EXPECT_EQ(boolvec_from_bitvec(bv), (std::vector<bool>{
+            1, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+            0, 0, 1, 1, 0,
+            1}));
+    EXPECT_EQ(bit::delta_code::length(1), 1u);
+    EXPECT_EQ(bit::delta_code::length(16), 9u);
+    EXPECT_EQ(bit::exp_golomb_code{3}.length(0), 4u);
+}
+
+TYPED_TEST(UniversalCodesTest, Gamma) {
+    auto values = make_code_values(std::numeric_limits<std::uint64_t>::max());
+    this->check_round_trip(bit::gamma_code(), values);
+}
+
+TYPED_TEST(UniversalCodesTest, Delta) {
+    auto values = make_code_values(std::numeric_limits<std::uint64_t>::max());
+    this->check_round_trip(bit::delta_code(), values);
+}
+
+TYPED_TEST(UniversalCodesTest, Rice) {
+    for (unsigned int k : {0u, 1u, 5u, 20u, 63u}) {
+        // Keep the unary quotients short enough to stay testable
+        auto values = make_code_values((std::uint64_t(1) << std::min(k + 10, 63u)) - 1);
+        values.push_back(0);
+        this->check_round_trip(bit::rice_code{k}, values);
+    }
+}
+
+TYPED_TEST(UniversalCodesTest, ExpGolomb) {
+    for (unsigned int k : {0u, 1u, 4u, 32u, 63u}) {
+        auto values = make_code_values(std::numeric_limits<std::uint64_t>::max() - (std::uint64_t(1) << k));
+        values.push_back(0);
+        this->check_round_trip(bit::exp_golomb_code{k}, values);
+    }
+}
+
+TYPED_TEST(UniversalCodesTest, LongUnary) {
+    using WordType = TypeParam;
+    bit::bit_vector<WordType> bv;
+    {
+        bit::bit_writer<WordType> writer(bv);
+        writer.put(5, 3);
+        writer.put_unary(1000);
+        writer.put_unary(0);
+        writer.put_unary(63);
+        writer.put_unary(64);
+        writer.put(0, 64);
+        writer.put(0, 36);
+    }
+    bit::bit_reader<WordType> reader(bv);
+    EXPECT_EQ(reader.get(3), 5u);
+    EXPECT_EQ(reader.get_unary(), 1000u);
+    EXPECT_EQ(reader.get_unary(), 0u);
+    EXPECT_EQ(reader.get_unary(), 63u);
+    EXPECT_EQ(reader.get_unary(), 64u);
+    // A run of zeros without its one
+    EXPECT_THROW(reader.get_unary(), std::out_of_range);
+
+    // Corrupt prefixes that are too long for a value are rejected
+    bit::bit_reader<WordType> too_long(bv);
+    too_long.skip(3);
+    EXPECT_THROW(bit::gamma_code().decode(too_long), std::out_of_range);
+}
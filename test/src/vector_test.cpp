@@ -9,6 +9,7 @@
 // ============================== PREAMBLE ================================== //
 // C++ standard library
 #include <math.h>
+#include <memory>
 #include <type_traits>
 // Project sources
 #include "bitlib/bit-containers/bit-containers.hpp"
@@ -209,6 +210,75 @@ TYPED_TEST(VectorTest, MoveAssignment) {
     }
 }
 
+// Allocator that counts the allocations made through it. Copies share the
+// counter and compare equal.
+template <class T>
+struct counting_allocator {
+    using value_type = T;
+    size_t* allocations;
+
+    explicit counting_allocator(size_t* allocations) noexcept : allocations(allocations) {}
+    template <class U>
+    counting_allocator(const counting_allocator<U>& other) noexcept : allocations(other.allocations) {}
+    T* allocate(size_t n) {
+        ++*allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n) noexcept {
+        std::allocator<T>().deallocate(p, n);
+    }
+    friend bool operator==(const counting_allocator& lhs, const counting_allocator& rhs) noexcept {
+        return lhs.allocations == rhs.allocations;
+    }
+    friend bool operator!=(const counting_allocator& lhs, const counting_allocator& rhs) noexcept {
+        return lhs.allocations != rhs.allocations;
+    }
+};
+
+// Test that moves and swaps take over the words without allocating
+TYPED_TEST(VectorTest, MoveWithoutAllocation) {
+    using WordType = typename TestFixture::base_type;
+    using alloc_type = counting_allocator<WordType>;
+    using vec_type = bit::bit_vector<WordType, alloc_type>;
+    static_assert(std::is_nothrow_move_constructible<vec_type>::value, "");
+    static_assert(std::is_nothrow_swappable<vec_type>::value, "");
+    size_t allocations = 0;
+    const alloc_type alloc(&allocations);
+    auto& boolvec = this->random_boolvecs[0];
+    vec_type bitvec(boolvec.size(), bit::bit0, alloc);
+    for (size_t i = 0; i < boolvec.size(); ++i) {
+        bitvec[i] = boolvec[i] ? bit::bit1 : bit::bit0;
+    }
+    const size_t before = allocations;
+
+    vec_type moved(std::move(bitvec));
+    EXPECT_TRUE(bitvec.empty());
+    vec_type assigned(alloc);
+    assigned = std::move(moved);
+    EXPECT_TRUE(moved.empty());
+    vec_type same_alloc(std::move(assigned), alloc);
+    EXPECT_TRUE(assigned.empty());
+    vec_type other(alloc);
+    swap(same_alloc, other);
+    EXPECT_TRUE(same_alloc.empty());
+    EXPECT_EQ(allocations, before);
+    EXPECT_TRUE(std::equal(other.begin(), other.end(), boolvec.begin(), boolvec.end(), comparator));
+
+    // Moving into another allocator has to copy the words
+    size_t other_allocations = 0;
+    vec_type moved_across(std::move(other), alloc_type(&other_allocations));
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other_allocations, boolvec.empty() ? 0u : 1u);
+    EXPECT_EQ(moved_across.get_allocator(), alloc_type(&other_allocations));
+    EXPECT_TRUE(std::equal(moved_across.begin(), moved_across.end(), boolvec.begin(), boolvec.end(), comparator));
+
+    // Growing a vector of bit vectors moves them rather than copying
+    std::vector<vec_type> vecs;
+    for (size_t i = 0; i < 100; ++i) {
+        vecs.push_back(vec_type(3 * this->digits, bit::bit1, alloc));
+    }
+    EXPECT_EQ(allocations, before + 100);
+}
 
 // Test the initializer list c'tor
 TYPED_TEST(VectorTest, InitializerListConstructor) {
@@ -749,6 +819,151 @@ TYPED_TEST(VectorTest, PopBack) {
 }
 
 
+// Test resize over bits left behind by pop_back
+TYPED_TEST(VectorTest, ResizeClearsTail) {
+    using vec_type = typename TestFixture::vec_type;
+    for (unsigned int veclen = 1; veclen < 3*this->digits; veclen++) {
+        vec_type bitvec(veclen, bit::bit1);
+        bitvec.pop_back();
+        bitvec.resize(veclen + this->digits);
+        EXPECT_EQ(std::count(bitvec.begin(), bitvec.end(), bit::bit1), veclen - 1);
+        bitvec.pop_back();
+        bitvec.resize(veclen + 2*this->digits, bit::bit1);
+        EXPECT_EQ(bitvec[veclen + this->digits - 1], bit::bit1);
+        EXPECT_EQ(std::count(bitvec.begin(), bitvec.end(), bit::bit1), veclen + this->digits);
+    }
+}
+
+// Test append
+TYPED_TEST(VectorTest, Append) {
+    using WordType = typename TestFixture::base_type;
+    for (unsigned int vec_idx = 0; vec_idx < this->random_bitvecs.size(); ++vec_idx) {
+        auto& bitvec = this->random_bitvecs[vec_idx];
+        auto& boolvec = this->random_boolvecs[vec_idx];
+        auto& other = this->random_bitvecs[(vec_idx + 1) % this->random_bitvecs.size()];
+        const auto start = generate_random_number(0, other.size());
+        bitvec.append(other.begin() + start, other.end());
+        for (auto it = other.begin() + start; it != other.end(); ++it) {
+            boolvec.push_back(*it == bit::bit1);
+        }
+        const size_t count = generate_random_number(0, 3*this->digits);
+        bool value = generate_random_number(0, 1);
+        bitvec.append(bit::bit_value(value), count);
+        boolvec.insert(boolvec.end(), count, value);
+        auto words = get_random_vec<WordType>(3);
+        bitvec.append_words(words.data(), words.size());
+        for (auto it = bit::bit_iterator<WordType*>(words.data()); it != bit::bit_iterator<WordType*>(words.data() + words.size()); ++it) {
+            boolvec.push_back(*it == bit::bit1);
+        }
+        EXPECT_TRUE(std::equal(
+                    bitvec.begin(),
+                    bitvec.end(),
+                    boolvec.begin(),
+                    boolvec.end(),
+                    comparator));
+    }
+}
+
+// Test that appends reallocate a logarithmic number of times
+TYPED_TEST(VectorTest, AmortizedGrowth) {
+    using WordType = typename TestFixture::base_type;
+    const WordType* data = nullptr;
+    size_t reallocations = 0;
+    for (size_t i = 0; i < (1 << 16); ++i) {
+        if (i % 3 == 0) {
+            this->empty_vec.push_back(bit::bit1);
+        } else {
+            this->empty_vec.append(bit::bit0, i % 7);
+        }
+        if (this->empty_vec.data() != data) {
+            data = this->empty_vec.data();
+            ++reallocations;
+        }
+        EXPECT_GE(this->empty_vec.capacity(), this->empty_vec.size());
+    }
+    EXPECT_LE(reallocations, 64u);
+}
+
+// Test &=, |=, ^=, -= and the length policies
+TYPED_TEST(VectorTest, CompoundAssignment) {
+    using vec_type = typename TestFixture::vec_type;
+    for (unsigned int vec_idx = 0; vec_idx + 1 < this->random_bitvecs.size(); ++vec_idx) {
+        const vec_type& lhs = this->random_bitvecs[vec_idx];
+        const vec_type& rhs = this->random_bitvecs[vec_idx + 1];
+        const auto& lhs_bool = this->random_boolvecs[vec_idx];
+        const auto& rhs_bool = this->random_boolvecs[vec_idx + 1];
+        const size_t longer = std::max(lhs.size(), rhs.size());
+        const size_t shorter = std::min(lhs.size(), rhs.size());
+        auto bit_at = [](const std::vector<bool>& v, size_t i) {return i < v.size() && v[i];};
+
+        vec_type and_vec = lhs, or_vec = lhs, xor_vec = lhs, andnot_vec = lhs;
+        and_vec &= rhs;
+        or_vec |= rhs;
+        xor_vec ^= rhs;
+        andnot_vec -= rhs;
+        vec_type truncated = lhs;
+        truncated.combine(rhs, std::bit_or<typename TestFixture::base_type>(), bit::length_policy::truncate);
+        ASSERT_EQ(and_vec.size(), longer);
+        ASSERT_EQ(andnot_vec.size(), longer);
+        ASSERT_EQ(truncated.size(), shorter);
+        for (size_t i = 0; i < longer; ++i) {
+            const bool a = bit_at(lhs_bool, i);
+            const bool b = bit_at(rhs_bool, i);
+            ASSERT_EQ(and_vec[i] == bit::bit1, a && b) << i;
+            ASSERT_EQ(or_vec[i] == bit::bit1, a || b) << i;
+            ASSERT_EQ(xor_vec[i] == bit::bit1, a != b) << i;
+            ASSERT_EQ(andnot_vec[i] == bit::bit1, a && !b) << i;
+            if (i < shorter) {
+                ASSERT_EQ(truncated[i] == bit::bit1, a || b) << i;
+            }
+        }
+    }
+    vec_type self = this->random_bitvecs.back();
+    self -= self;
+    EXPECT_EQ(std::count(self.begin(), self.end(), bit::bit1), 0);
+}
+
+// Test ==, != and the lexicographical order against std::vector<bool>
+TYPED_TEST(VectorTest, Comparison) {
+    using vec_type = typename TestFixture::vec_type;
+    auto expect_order = [](const vec_type& lhs, const vec_type& rhs,
+            const std::vector<bool>& lhs_bool, const std::vector<bool>& rhs_bool) {
+        EXPECT_EQ(lhs == rhs, lhs_bool == rhs_bool);
+        EXPECT_EQ(lhs != rhs, lhs_bool != rhs_bool);
+        EXPECT_EQ(lhs < rhs, lhs_bool < rhs_bool);
+        EXPECT_EQ(lhs <= rhs, lhs_bool <= rhs_bool);
+        EXPECT_EQ(lhs > rhs, lhs_bool > rhs_bool);
+        EXPECT_EQ(lhs >= rhs, lhs_bool >= rhs_bool);
+    };
+    for (unsigned int vec_idx = 0; vec_idx + 1 < this->random_bitvecs.size(); ++vec_idx) {
+        const vec_type& lhs = this->random_bitvecs[vec_idx];
+        const vec_type& rhs = this->random_bitvecs[vec_idx + 1];
+        expect_order(lhs, rhs, this->random_boolvecs[vec_idx], this->random_boolvecs[vec_idx + 1]);
+        expect_order(lhs, lhs, this->random_boolvecs[vec_idx], this->random_boolvecs[vec_idx]);
+    }
+
+    // Vectors that only differ in their last bit, or in their size
+    vec_type lhs = this->random_bitvecs.back();
+    std::vector<bool> lhs_bool = this->random_boolvecs.back();
+    vec_type rhs = lhs;
+    std::vector<bool> rhs_bool = lhs_bool;
+    rhs.back() = ~rhs.back();
+    rhs_bool.back() = !rhs_bool.back();
+    expect_order(lhs, rhs, lhs_bool, rhs_bool);
+    rhs = lhs;
+    rhs_bool = lhs_bool;
+    rhs.push_back(bit::bit0);
+    rhs_bool.push_back(false);
+    expect_order(lhs, rhs, lhs_bool, rhs_bool);
+    expect_order(vec_type(), vec_type(), {}, {});
+    expect_order(vec_type(), rhs, {}, rhs_bool);
+#if __cplusplus >= 202002L
+    EXPECT_EQ(lhs <=> rhs, std::strong_ordering::less);
+    EXPECT_EQ(rhs <=> lhs, std::strong_ordering::greater);
+    EXPECT_EQ(lhs <=> lhs, std::strong_ordering::equal);
+#endif
+}
+
 //TYPED_TEST(VectorTest, Print) {
     //std::cout << this->v3_ << std::endl;
 //}